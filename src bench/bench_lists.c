@@ -0,0 +1,445 @@
+/* ==========================================
+ * bench_lists.c
+ * Throughput / latency benchmark for gllist, gulist, gmbdllist
+ * and a plain ring buffer.
+ *
+ * Build (from the repository root):
+ *   cc -std=c11 -O2 -D_GNU_SOURCE -Isrc "src bench/bench_lists.c" \
+ *      src/gllist.c src/gulist.c src/gmbdllist.c -o bench_lists
+ * Run:
+ *   ./bench_lists [max_size]      (default 1048576, up to 10485760)
+ *
+ * Output is tab-separated, one line per (container, op, size):
+ * ops/sec, p50/p99 per-op latency over batches of BENCH_BATCH ops,
+ * and hardware cache misses per op when perf events are available.
+ * See bench_std.cpp for std::deque / std::list in the same format.
+ * ========================================== */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_util.h"
+#include "gllist.h"
+#include "gulist.h"
+#include "gmbdllist.h"
+
+/* Payloads are small integers stored directly in the data pointer */
+#define VAL(i) ((void *)(uintptr_t)((i) + 1))
+
+/* ---------------------------
+   Container adapters
+   --------------------------- */
+
+typedef struct {
+    const char *name;
+    void *(*create)(size_t cap);
+    void (*destroy)(void *c);
+    int (*push_back)(void *c, void *v);
+    int (*push_front)(void *c, void *v);
+    void *(*pop_front)(void *c);
+    void *(*pop_back)(void *c);
+    uintptr_t (*traverse)(void *c);
+    void (*clear)(void *c);
+    /* optional operations (NULL = not supported) */
+    void *(*find)(void *c, void *key);
+    void *(*find_key)(void *c, void *key);
+    size_t (*handles)(void *c, void **out);
+    void (*remove)(void *c, void *handle);
+} bench_container;
+
+/* gllist, malloc per node */
+static void *gl_create(size_t cap) {
+    (void)cap;
+    gllist *l = malloc(sizeof(*l));
+    if (l) list_init(l);
+    return l;
+}
+static void gl_destroy(void *c) { list_destroy(c); free(c); }
+static int gl_push_back(void *c, void *v) { return list_push_back(c, v); }
+static int gl_push_front(void *c, void *v) { return list_push_front(c, v); }
+static void *gl_pop_front(void *c) { return list_pop_front(c); }
+static void *gl_pop_back(void *c) { return list_pop_back(c); }
+static void gl_clear(void *c) { list_destroy(c); }
+static uintptr_t gl_traverse(void *c) {
+    uintptr_t sum = 0;
+    for (const Node *n = ((gllist *)c)->head; n; n = n->next) sum += (uintptr_t)n->data;
+    return sum;
+}
+
+/* gllist on a slab */
+typedef struct {
+    gllist list;
+    gllist_slab slab;
+} gls_t;
+
+static void *gls_create(size_t cap) {
+    (void)cap;
+    gls_t *s = malloc(sizeof(*s));
+    if (!s) return NULL;
+    list_slab_init(&s->slab, 0);
+    list_init_slab(&s->list, &s->slab);
+    return s;
+}
+static void gls_destroy(void *c) {
+    gls_t *s = c;
+    list_destroy(&s->list);
+    list_slab_destroy(&s->slab);
+    free(s);
+}
+
+/* gulist */
+static void *gu_create(size_t cap) {
+    (void)cap;
+    gulist *l = malloc(sizeof(*l));
+    if (l) ulist_init(l);
+    return l;
+}
+static void gu_destroy(void *c) { ulist_destroy(c); free(c); }
+static int gu_push_back(void *c, void *v) { return ulist_push_back(c, v); }
+static int gu_push_front(void *c, void *v) { return ulist_push_front(c, v); }
+static void *gu_pop_front(void *c) { return ulist_pop_front(c); }
+static void *gu_pop_back(void *c) { return ulist_pop_back(c); }
+static void gu_clear(void *c) { ulist_destroy(c); }
+static uintptr_t gu_traverse(void *c) {
+    uintptr_t sum = 0;
+    for (const UBlock *b = ((gulist *)c)->head; b; b = b->next) {
+        for (unsigned i = b->begin; i < b->end; ++i) sum += (uintptr_t)b->items[i];
+    }
+    return sum;
+}
+
+/* gmbdllist on a caller buffer, optionally with a hash index */
+typedef struct {
+    gmbdll_Pool pool;
+    gmbdll_List list;
+    gmbdll_Node *nodes;
+    gmbdll_Index index;
+    gmbdll_IndexSlot *slots;
+} gmb_t;
+
+static size_t hash_ptr(const void *key) {
+    return (size_t)((uintptr_t)key * UINT64_C(0x9E3779B97F4A7C15) >> 16);
+}
+static int cmp_ptr(const void *item, const void *key) { return item != key; }
+
+static void *gmb_create_common(size_t cap, int with_index) {
+    gmb_t *g = calloc(1, sizeof(*g));
+    if (!g) return NULL;
+    g->nodes = malloc(cap * sizeof(gmbdll_Node));
+    if (!g->nodes || gmbdll_pool_init_buffer(&g->pool, g->nodes, cap) != gmbdll_OK) {
+        free(g->nodes);
+        free(g);
+        return NULL;
+    }
+    gmbdll_list_init(&g->list, &g->pool);
+    if (with_index) {
+        size_t nslots = 2;
+        while (nslots < 2 * cap) nslots *= 2;
+        g->slots = malloc(nslots * sizeof(gmbdll_IndexSlot));
+        if (!g->slots) {
+            free(g->nodes);
+            free(g);
+            return NULL;
+        }
+        gmbdll_index_init(&g->index, g->slots, nslots, NULL, hash_ptr, cmp_ptr);
+        gmbdll_list_attach_index(&g->list, &g->index);
+    }
+    return g;
+}
+static void *gmb_create(size_t cap) { return gmb_create_common(cap, 0); }
+static void *gmbi_create(size_t cap) { return gmb_create_common(cap, 1); }
+static void gmb_destroy(void *c) {
+    gmb_t *g = c;
+    free(g->slots);
+    free(g->nodes);
+    free(g);
+}
+static int gmb_push_back(void *c, void *v) { return gmbdll_push_back(&((gmb_t *)c)->list, v); }
+static int gmb_push_front(void *c, void *v) { return gmbdll_push_front(&((gmb_t *)c)->list, v); }
+static void *gmb_pop_front(void *c) { return gmbdll_pop_front(&((gmb_t *)c)->list); }
+static void *gmb_pop_back(void *c) { return gmbdll_pop_back(&((gmb_t *)c)->list); }
+static void gmb_clear(void *c) { gmbdll_list_clear(&((gmb_t *)c)->list, NULL); }
+static uintptr_t gmb_traverse(void *c) {
+    const gmbdll_List *l = &((gmb_t *)c)->list;
+    uintptr_t sum = 0;
+    for (const gmbdll_Node *n = gmbdll_list_head(l); n; n = gmbdll_node_next(l, n)) {
+        sum += (uintptr_t)n->data;
+    }
+    return sum;
+}
+static void *gmb_find(void *c, void *key) {
+    return gmbdll_list_find(&((gmb_t *)c)->list, cmp_ptr, key);
+}
+static void *gmb_find_key(void *c, void *key) {
+    return gmbdll_list_find_key(&((gmb_t *)c)->list, key);
+}
+static size_t gmb_handles(void *c, void **out) {
+    const gmbdll_List *l = &((gmb_t *)c)->list;
+    size_t count = 0;
+    for (gmbdll_Node *n = gmbdll_list_head(l); n; n = gmbdll_node_next(l, n)) out[count++] = n;
+    return count;
+}
+static void gmb_remove(void *c, void *handle) {
+    gmbdll_list_remove_node(&((gmb_t *)c)->list, handle, NULL);
+}
+
+/* Plain ring buffer (power-of-two capacity) as the array baseline */
+typedef struct {
+    void **items;
+    size_t mask;
+    size_t head;  /* index of the first element */
+    size_t tail;  /* one past the last element */
+} ring_t;
+
+static void *ring_create(size_t cap) {
+    ring_t *r = malloc(sizeof(*r));
+    if (!r) return NULL;
+    size_t size = 2;
+    while (size < cap) size *= 2;
+    r->items = malloc(size * sizeof(void *));
+    if (!r->items) {
+        free(r);
+        return NULL;
+    }
+    r->mask = size - 1;
+    r->head = r->tail = 0;
+    return r;
+}
+static void ring_destroy(void *c) { free(((ring_t *)c)->items); free(c); }
+static int ring_push_back(void *c, void *v) {
+    ring_t *r = c;
+    if (r->tail - r->head > r->mask) return -1;
+    r->items[r->tail++ & r->mask] = v;
+    return 0;
+}
+static int ring_push_front(void *c, void *v) {
+    ring_t *r = c;
+    if (r->tail - r->head > r->mask) return -1;
+    r->items[--r->head & r->mask] = v;
+    return 0;
+}
+static void *ring_pop_front(void *c) {
+    ring_t *r = c;
+    return r->head == r->tail ? NULL : r->items[r->head++ & r->mask];
+}
+static void *ring_pop_back(void *c) {
+    ring_t *r = c;
+    return r->head == r->tail ? NULL : r->items[--r->tail & r->mask];
+}
+static void ring_clear(void *c) { ((ring_t *)c)->head = ((ring_t *)c)->tail = 0; }
+static uintptr_t ring_traverse(void *c) {
+    ring_t *r = c;
+    uintptr_t sum = 0;
+    for (size_t i = r->head; i != r->tail; ++i) sum += (uintptr_t)r->items[i & r->mask];
+    return sum;
+}
+static void *ring_find(void *c, void *key) {
+    ring_t *r = c;
+    for (size_t i = r->head; i != r->tail; ++i) {
+        if (r->items[i & r->mask] == key) return &r->items[i & r->mask];
+    }
+    return NULL;
+}
+
+static const bench_container containers[] = {
+    {"gllist", gl_create, gl_destroy, gl_push_back, gl_push_front, gl_pop_front,
+     gl_pop_back, gl_traverse, gl_clear, NULL, NULL, NULL, NULL},
+    {"gllist_slab", gls_create, gls_destroy, gl_push_back, gl_push_front, gl_pop_front,
+     gl_pop_back, gl_traverse, gl_clear, NULL, NULL, NULL, NULL},
+    {"gulist", gu_create, gu_destroy, gu_push_back, gu_push_front, gu_pop_front,
+     gu_pop_back, gu_traverse, gu_clear, NULL, NULL, NULL, NULL},
+    {"gmbdllist", gmb_create, gmb_destroy, gmb_push_back, gmb_push_front, gmb_pop_front,
+     gmb_pop_back, gmb_traverse, gmb_clear, gmb_find, NULL, gmb_handles, gmb_remove},
+    {"gmbdllist_index", gmbi_create, gmb_destroy, gmb_push_back, gmb_push_front,
+     gmb_pop_front, gmb_pop_back, gmb_traverse, gmb_clear, gmb_find, gmb_find_key,
+     gmb_handles, gmb_remove},
+    {"ring", ring_create, ring_destroy, ring_push_back, ring_push_front, ring_pop_front,
+     ring_pop_back, ring_traverse, ring_clear, ring_find, NULL, NULL, NULL},
+};
+
+/* ---------------------------
+   Benchmarks
+   --------------------------- */
+
+static volatile uintptr_t sink; /* keeps results alive */
+static uint64_t rng_state = 88172645463325252u;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void fill(const bench_container *bc, void *c, size_t n) {
+    for (size_t i = 0; i < n; ++i) bc->push_back(c, VAL(i));
+}
+
+/* Time n pushes at one end, batch by batch */
+static void bench_push(const bench_container *bc, void *c, size_t n, int back,
+                       bench_lat *lat, bench_perf *perf) {
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        bench_perf_start(perf);
+        for (size_t i = 0; i < n; i += BENCH_BATCH) {
+            size_t m = n - i < BENCH_BATCH ? n - i : BENCH_BATCH;
+            uint64_t t0 = bench_now_ns();
+            for (size_t j = 0; j < m; ++j) {
+                if (back) bc->push_back(c, VAL(i + j));
+                else bc->push_front(c, VAL(i + j));
+            }
+            bench_lat_add(lat, bench_now_ns() - t0, m);
+        }
+        bench_perf_stop(perf);
+        bc->clear(c);
+    }
+}
+
+/* Time n pops at one end of a full container */
+static void bench_pop(const bench_container *bc, void *c, size_t n, int front,
+                      bench_lat *lat, bench_perf *perf) {
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        fill(bc, c, n);
+        bench_perf_start(perf);
+        for (size_t i = 0; i < n; i += BENCH_BATCH) {
+            size_t m = n - i < BENCH_BATCH ? n - i : BENCH_BATCH;
+            uintptr_t sum = 0;
+            uint64_t t0 = bench_now_ns();
+            for (size_t j = 0; j < m; ++j) {
+                sum += (uintptr_t)(front ? bc->pop_front(c) : bc->pop_back(c));
+            }
+            bench_lat_add(lat, bench_now_ns() - t0, m);
+            sink += sum;
+        }
+        bench_perf_stop(perf);
+    }
+}
+
+/* Time full traversals (per element) */
+static void bench_traverse(const bench_container *bc, void *c, size_t n,
+                           bench_lat *lat, bench_perf *perf) {
+    fill(bc, c, n);
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        sink += bc->traverse(c);
+        bench_lat_add(lat, bench_now_ns() - t0, n);
+        bench_perf_stop(perf);
+    }
+    bc->clear(c);
+}
+
+/* Time clearing a full container (per element) */
+static void bench_clear(const bench_container *bc, void *c, size_t n,
+                        bench_lat *lat, bench_perf *perf) {
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        fill(bc, c, n);
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        bc->clear(c);
+        bench_lat_add(lat, bench_now_ns() - t0, n);
+        bench_perf_stop(perf);
+    }
+}
+
+/* Time lookups of random present keys (linear find or hash find_key) */
+static void bench_find(const bench_container *bc, void *c, size_t n, int hashed,
+                       bench_lat *lat, bench_perf *perf) {
+    /* linear finds touch n/2 nodes each: bound the total work */
+    size_t finds = hashed ? n * bench_reps(n) : ((size_t)1 << 25) / n;
+    size_t batch = (!hashed && n >= 4096) ? 1 : BENCH_BATCH;
+    if (finds < 4) finds = 4;
+    fill(bc, c, n);
+    bench_perf_start(perf);
+    for (size_t i = 0; i < finds; i += batch) {
+        size_t m = finds - i < batch ? finds - i : batch;
+        uintptr_t sum = 0;
+        uint64_t t0 = bench_now_ns();
+        for (size_t j = 0; j < m; ++j) {
+            void *key = VAL(rng_next() % n);
+            sum += (uintptr_t)(hashed ? bc->find_key(c, key) : bc->find(c, key));
+        }
+        bench_lat_add(lat, bench_now_ns() - t0, m);
+        sink += sum;
+    }
+    bench_perf_stop(perf);
+    bc->clear(c);
+}
+
+/* Time removal of every node by handle, in random order */
+static void bench_remove(const bench_container *bc, void *c, size_t n,
+                         bench_lat *lat, bench_perf *perf) {
+    void **handles = malloc(n * sizeof(void *));
+    if (!handles) return;
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        fill(bc, c, n);
+        size_t count = bc->handles(c, handles);
+        for (size_t i = count; i > 1; --i) {
+            size_t j = rng_next() % i;
+            void *tmp = handles[i - 1];
+            handles[i - 1] = handles[j];
+            handles[j] = tmp;
+        }
+        bench_perf_start(perf);
+        for (size_t i = 0; i < count; i += BENCH_BATCH) {
+            size_t m = count - i < BENCH_BATCH ? count - i : BENCH_BATCH;
+            uint64_t t0 = bench_now_ns();
+            for (size_t j = 0; j < m; ++j) bc->remove(c, handles[i + j]);
+            bench_lat_add(lat, bench_now_ns() - t0, m);
+        }
+        bench_perf_stop(perf);
+    }
+    free(handles);
+}
+
+enum { OP_PUSH_BACK, OP_PUSH_FRONT, OP_POP_FRONT, OP_POP_BACK, OP_TRAVERSE,
+       OP_CLEAR, OP_FIND, OP_FIND_KEY, OP_REMOVE_NODE, OP_COUNT };
+
+static const char *op_names[OP_COUNT] = {
+    "push_back", "push_front", "pop_front", "pop_back", "traverse",
+    "clear", "find", "find_key", "remove_node"
+};
+
+int main(int argc, char **argv) {
+    size_t max = bench_max_size(argc, argv);
+    bench_lat lat = {0};
+    bench_perf perf;
+    bench_perf_open(&perf);
+    if (perf.fd < 0) fprintf(stderr, "perf events unavailable: cache misses not reported\n");
+
+    bench_header();
+    for (size_t s = 0; s < BENCH_NSIZES && bench_sizes[s] <= max; ++s) {
+        size_t n = bench_sizes[s];
+        for (size_t k = 0; k < sizeof(containers) / sizeof(containers[0]); ++k) {
+            const bench_container *bc = &containers[k];
+            void *c = bc->create(n);
+            if (!c) {
+                fprintf(stderr, "%s: cannot allocate %zu elements\n", bc->name, n);
+                continue;
+            }
+            for (int op = 0; op < OP_COUNT; ++op) {
+                if ((op == OP_FIND && !bc->find) || (op == OP_FIND_KEY && !bc->find_key) ||
+                    (op == OP_REMOVE_NODE && !bc->remove)) {
+                    continue;
+                }
+                bench_lat_reset(&lat);
+                perf.total = 0;
+                switch (op) {
+                case OP_PUSH_BACK:   bench_push(bc, c, n, 1, &lat, &perf); break;
+                case OP_PUSH_FRONT:  bench_push(bc, c, n, 0, &lat, &perf); break;
+                case OP_POP_FRONT:   bench_pop(bc, c, n, 1, &lat, &perf); break;
+                case OP_POP_BACK:    bench_pop(bc, c, n, 0, &lat, &perf); break;
+                case OP_TRAVERSE:    bench_traverse(bc, c, n, &lat, &perf); break;
+                case OP_CLEAR:       bench_clear(bc, c, n, &lat, &perf); break;
+                case OP_FIND:        bench_find(bc, c, n, 0, &lat, &perf); break;
+                case OP_FIND_KEY:    bench_find(bc, c, n, 1, &lat, &perf); break;
+                case OP_REMOVE_NODE: bench_remove(bc, c, n, &lat, &perf); break;
+                }
+                bench_report(bc->name, op_names[op], n, &lat, &perf);
+            }
+            bc->destroy(c);
+        }
+    }
+    free(lat.ns);
+    return 0;
+}
@@ -0,0 +1,208 @@
+/* ==========================================
+ * bench_skip.c
+ * Ordered set benchmark: the gmbskip skip list against a sorted
+ * gmbdll_List kept with gmbdll_list_insert_sorted / gmbdll_list_find
+ * (linear scans).
+ *
+ * Build (from the repository root):
+ *   cc -std=c11 -O2 -D_GNU_SOURCE -Isrc "src bench/bench_skip.c" \
+ *      src/gmbskip.c src/gmbdllist.c -o bench_skip
+ * Run:
+ *   ./bench_skip [max_size] [max_linear]   (defaults 1048576, 65536)
+ *
+ * The sorted list is O(n) per operation, so it only runs up to
+ * max_linear elements. Keys are inserted, looked up and erased in
+ * pseudo-random order; range reads lower_bound + RANGE elements.
+ * Output is tab-separated in the bench_lists format.
+ * ========================================== */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_util.h"
+#include "gmbdllist.h"
+#include "gmbskip.h"
+
+#define RANGE 16     /* elements read per range query */
+#define QUERIES 4096 /* lookups per measurement on the sorted list */
+
+/* Distinct pseudo-random keys stored directly in the data pointer
+   (odd multiplier: a bijection on 32 bits) */
+#define KEY(i) ((void *)(uintptr_t)(((uint32_t)(i) * 2654435761u) + (uintptr_t)1))
+/* i-th index of a second visiting order (odd stride, n a power of two) */
+#define PERM(i, n) (((i) * 7919) % (n))
+
+static volatile uintptr_t sink;
+
+static int cmp_key(const void *item, const void *key) {
+    uintptr_t a = (uintptr_t)item, b = (uintptr_t)key;
+    return (a > b) - (a < b);
+}
+
+/* gmbdll_list_find predicate for a lower bound: first item >= key */
+static int cmp_not_less(const void *item, const void *key) {
+    return (uintptr_t)item < (uintptr_t)key;
+}
+
+/* ---------------------------
+   Skip list
+   --------------------------- */
+
+static void bench_skip(size_t n, bench_lat *lat, bench_perf *perf) {
+    /* 64 bytes per element leaves ample room above the ~30 byte mean tower */
+    void **buffer = malloc(n * 64);
+    gmbdll_SkipPool pool;
+    gmbdll_SkipList sl;
+    if (!buffer) return;
+    size_t reps = bench_reps(n);
+    if (reps > 64) reps = 64;
+
+    bench_lat_reset(lat);
+    perf->total = 0;
+    for (size_t r = 0; r < reps; ++r) {
+        gmbdll_skippool_init(&pool, buffer, n * 64);
+        gmbdll_skip_init(&sl, &pool, NULL, cmp_key, 1);
+        for (size_t i = 0; i < n; i += BENCH_BATCH) {
+            size_t end = i + BENCH_BATCH < n ? i + BENCH_BATCH : n;
+            bench_perf_start(perf);
+            uint64_t t0 = bench_now_ns();
+            for (size_t k = i; k < end; ++k) gmbdll_skip_insert(&sl, KEY(k), NULL);
+            bench_lat_add(lat, bench_now_ns() - t0, end - i);
+            bench_perf_stop(perf);
+        }
+    }
+    bench_report("gmbskip", "insert", n, lat, perf);
+
+    bench_lat_reset(lat);
+    perf->total = 0;
+    for (size_t i = 0; i < n * reps; i += BENCH_BATCH) {
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        for (size_t k = i; k < i + BENCH_BATCH; ++k) {
+            sink = (uintptr_t)gmbdll_skip_find(&sl, KEY(PERM(k, n)));
+        }
+        bench_lat_add(lat, bench_now_ns() - t0, BENCH_BATCH);
+        bench_perf_stop(perf);
+    }
+    bench_report("gmbskip", "find", n, lat, perf);
+
+    bench_lat_reset(lat);
+    perf->total = 0;
+    for (size_t i = 0; i < n * reps; i += BENCH_BATCH) {
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        for (size_t k = i; k < i + BENCH_BATCH; ++k) {
+            const gmbdll_SkipNode *node = gmbdll_skip_lower_bound(&sl, KEY(PERM(k, n)));
+            for (int j = 0; j < RANGE && node; ++j, node = gmbdll_skip_next(node)) {
+                sink += (uintptr_t)node->data;
+            }
+        }
+        bench_lat_add(lat, bench_now_ns() - t0, BENCH_BATCH);
+        bench_perf_stop(perf);
+    }
+    bench_report("gmbskip", "range", n, lat, perf);
+
+    bench_lat_reset(lat);
+    perf->total = 0;
+    for (size_t i = 0; i < n; i += BENCH_BATCH) {
+        size_t end = i + BENCH_BATCH < n ? i + BENCH_BATCH : n;
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        for (size_t k = i; k < end; ++k) gmbdll_skip_erase(&sl, KEY(PERM(k, n)), NULL);
+        bench_lat_add(lat, bench_now_ns() - t0, end - i);
+        bench_perf_stop(perf);
+    }
+    bench_report("gmbskip", "erase", n, lat, perf);
+    free(buffer);
+}
+
+/* ---------------------------
+   Sorted gmbdll_List (linear scans)
+   --------------------------- */
+
+static void bench_sorted_list(size_t n, bench_lat *lat, bench_perf *perf) {
+    gmbdll_Node *nodes = malloc(n * sizeof(*nodes));
+    gmbdll_Pool pool;
+    gmbdll_List list;
+    if (!nodes) return;
+    size_t queries = n < QUERIES ? n : QUERIES;
+
+    bench_lat_reset(lat);
+    perf->total = 0;
+    gmbdll_pool_init_buffer(&pool, nodes, n);
+    gmbdll_list_init(&list, &pool);
+    for (size_t i = 0; i < n; i += BENCH_BATCH) {
+        size_t end = i + BENCH_BATCH < n ? i + BENCH_BATCH : n;
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        for (size_t k = i; k < end; ++k) gmbdll_list_insert_sorted(&list, KEY(k), cmp_key, NULL);
+        bench_lat_add(lat, bench_now_ns() - t0, end - i);
+        bench_perf_stop(perf);
+    }
+    bench_report("gmbdllist_sorted", "insert", n, lat, perf);
+
+    bench_lat_reset(lat);
+    perf->total = 0;
+    for (size_t i = 0; i < queries; i += BENCH_BATCH) {
+        size_t end = i + BENCH_BATCH < queries ? i + BENCH_BATCH : queries;
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        for (size_t k = i; k < end; ++k) {
+            sink = (uintptr_t)gmbdll_list_find(&list, cmp_key, KEY(PERM(k, n)));
+        }
+        bench_lat_add(lat, bench_now_ns() - t0, end - i);
+        bench_perf_stop(perf);
+    }
+    bench_report("gmbdllist_sorted", "find", n, lat, perf);
+
+    bench_lat_reset(lat);
+    perf->total = 0;
+    for (size_t i = 0; i < queries; i += BENCH_BATCH) {
+        size_t end = i + BENCH_BATCH < queries ? i + BENCH_BATCH : queries;
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        for (size_t k = i; k < end; ++k) {
+            const gmbdll_Node *node = gmbdll_list_find(&list, cmp_not_less, KEY(PERM(k, n)));
+            for (int j = 0; j < RANGE && node; ++j, node = gmbdll_node_next(&list, node)) {
+                sink += (uintptr_t)gmbdll_node_value(node);
+            }
+        }
+        bench_lat_add(lat, bench_now_ns() - t0, end - i);
+        bench_perf_stop(perf);
+    }
+    bench_report("gmbdllist_sorted", "range", n, lat, perf);
+
+    bench_lat_reset(lat);
+    perf->total = 0;
+    for (size_t i = 0; i < n; i += BENCH_BATCH) {
+        size_t end = i + BENCH_BATCH < n ? i + BENCH_BATCH : n;
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        for (size_t k = i; k < end; ++k) {
+            gmbdll_Node *node = gmbdll_list_find(&list, cmp_key, KEY(PERM(k, n)));
+            gmbdll_list_remove_node(&list, node, NULL);
+        }
+        bench_lat_add(lat, bench_now_ns() - t0, end - i);
+        bench_perf_stop(perf);
+    }
+    bench_report("gmbdllist_sorted", "erase", n, lat, perf);
+    free(nodes);
+}
+
+int main(int argc, char **argv) {
+    size_t max = bench_max_size(argc, argv);
+    size_t max_linear = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 65536;
+    bench_lat lat = {0};
+    bench_perf perf;
+    bench_perf_open(&perf);
+
+    bench_header();
+    for (size_t s = 0; s < BENCH_NSIZES && bench_sizes[s] <= max; ++s) {
+        size_t n = bench_sizes[s];
+        bench_skip(n, &lat, &perf);
+        if (n <= max_linear) bench_sorted_list(n, &lat, &perf);
+    }
+    free(lat.ns);
+    return 0;
+}
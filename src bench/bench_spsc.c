@@ -0,0 +1,154 @@
+/* ==========================================
+ * bench_spsc.c
+ * Producer/consumer throughput between two threads: the SPSC ring
+ * (single and batched operations) against a mutex-protected gmbdll_List
+ * FIFO of the same depth.
+ *
+ * Build (from the repository root):
+ *   cc -std=c11 -O2 -D_GNU_SOURCE -pthread -Isrc "src bench/bench_spsc.c" \
+ *      src/gmbspsc.c src/gmbdllist.c -o bench_spsc
+ * Run:
+ *   ./bench_spsc [items]      (default 20000000)
+ *
+ * Pin the two threads to different cores (e.g. taskset -c 0,2) for
+ * cross-core numbers. Output is tab-separated, one line per queue:
+ * items moved per second.
+ * ========================================== */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "bench_util.h"
+#include "gmbdllist.h"
+#include "gmbspsc.h"
+
+#define DEPTH 1024  /* queue capacity, a power of two */
+#define BATCH 32    /* elements per batched operation */
+
+/* Payloads are sequence numbers stored directly in the data pointer */
+#define VAL(i) ((void *)(uintptr_t)((i) + 1))
+
+static size_t items;
+static void *slots[DEPTH];
+static gmbdll_Spsc ring;
+static gmbdll_Node nodes[DEPTH];
+static gmbdll_Pool pool;
+static gmbdll_List list;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static volatile uintptr_t sink;
+
+/* ---------------------------
+   Producers
+   --------------------------- */
+
+static void *ring_producer(void *arg) {
+    (void)arg;
+    for (size_t i = 0; i < items; ) {
+        if (gmbdll_spsc_push_back(&ring, VAL(i)) == gmbdll_OK) {
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *ring_batch_producer(void *arg) {
+    (void)arg;
+    void *batch[BATCH];
+    for (size_t i = 0; i < items; ) {
+        size_t n = items - i < BATCH ? items - i : BATCH;
+        for (size_t k = 0; k < n; ++k) batch[k] = VAL(i + k);
+        size_t done = 0;
+        while (done < n) {
+            size_t pushed = gmbdll_spsc_push_back_n(&ring, batch + done, n - done);
+            if (pushed == 0) sched_yield();
+            done += pushed;
+        }
+        i += n;
+    }
+    return NULL;
+}
+
+static void *list_producer(void *arg) {
+    (void)arg;
+    for (size_t i = 0; i < items; ) {
+        pthread_mutex_lock(&lock);
+        int rc = gmbdll_push_back(&list, VAL(i));
+        pthread_mutex_unlock(&lock);
+        if (rc == gmbdll_OK) {
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/* ---------------------------
+   Consumers (run on the main thread)
+   --------------------------- */
+
+static void ring_consume(void) {
+    for (size_t i = 0; i < items; ) {
+        void *v = gmbdll_spsc_pop_front(&ring);
+        if (v) {
+            sink = (uintptr_t)v;
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+static void ring_batch_consume(void) {
+    void *batch[BATCH];
+    for (size_t i = 0; i < items; ) {
+        size_t n = gmbdll_spsc_pop_front_n(&ring, batch, BATCH);
+        if (n == 0) sched_yield();
+        for (size_t k = 0; k < n; ++k) sink = (uintptr_t)batch[k];
+        i += n;
+    }
+}
+
+static void list_consume(void) {
+    for (size_t i = 0; i < items; ) {
+        pthread_mutex_lock(&lock);
+        void *v = gmbdll_pop_front(&list);
+        pthread_mutex_unlock(&lock);
+        if (v) {
+            sink = (uintptr_t)v;
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+static void run(const char *name, void *(*producer)(void *), void (*consume)(void)) {
+    pthread_t thread;
+    uint64_t t0 = bench_now_ns();
+    pthread_create(&thread, NULL, producer, NULL);
+    consume();
+    pthread_join(thread, NULL);
+    double secs = (double)(bench_now_ns() - t0) / 1e9;
+    printf("%s\t%zu\t%.0f\n", name, items, (double)items / secs);
+    fflush(stdout);
+}
+
+int main(int argc, char **argv) {
+    items = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 20000000;
+
+    printf("queue\titems\tops_per_sec\n");
+    gmbdll_spsc_init(&ring, slots, DEPTH);
+    run("gmbspsc", ring_producer, ring_consume);
+    gmbdll_spsc_init(&ring, slots, DEPTH);
+    run("gmbspsc_batch", ring_batch_producer, ring_batch_consume);
+    gmbdll_pool_init_buffer(&pool, nodes, DEPTH);
+    gmbdll_list_init(&list, &pool);
+    run("gmbdllist_mutex", list_producer, list_consume);
+    return 0;
+}
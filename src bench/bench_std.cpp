@@ -0,0 +1,188 @@
+/* ==========================================
+ * bench_std.cpp
+ * std::deque / std::list baselines for bench_lists.c,
+ * same operations and output format.
+ *
+ * Build (from the repository root):
+ *   c++ -std=c++17 -O2 -Isrc "src bench/bench_std.cpp" -o bench_std
+ * Run:
+ *   ./bench_std [max_size]
+ * ========================================== */
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "bench_util.h"
+
+#define VAL(i) (reinterpret_cast<void *>(static_cast<uintptr_t>((i) + 1)))
+
+static volatile uintptr_t sink;
+
+template <typename C>
+static void fill(C &c, size_t n) {
+    for (size_t i = 0; i < n; ++i) c.push_back(VAL(i));
+}
+
+template <typename C>
+static void bench_push(C &c, size_t n, bool back, bench_lat *lat, bench_perf *perf) {
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        bench_perf_start(perf);
+        for (size_t i = 0; i < n; i += BENCH_BATCH) {
+            size_t m = std::min<size_t>(BENCH_BATCH, n - i);
+            uint64_t t0 = bench_now_ns();
+            for (size_t j = 0; j < m; ++j) {
+                if (back) c.push_back(VAL(i + j));
+                else c.push_front(VAL(i + j));
+            }
+            bench_lat_add(lat, bench_now_ns() - t0, m);
+        }
+        bench_perf_stop(perf);
+        c.clear();
+    }
+}
+
+template <typename C>
+static void bench_pop(C &c, size_t n, bool front, bench_lat *lat, bench_perf *perf) {
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        fill(c, n);
+        bench_perf_start(perf);
+        for (size_t i = 0; i < n; i += BENCH_BATCH) {
+            size_t m = std::min<size_t>(BENCH_BATCH, n - i);
+            uintptr_t sum = 0;
+            uint64_t t0 = bench_now_ns();
+            for (size_t j = 0; j < m; ++j) {
+                if (front) {
+                    sum += reinterpret_cast<uintptr_t>(c.front());
+                    c.pop_front();
+                } else {
+                    sum += reinterpret_cast<uintptr_t>(c.back());
+                    c.pop_back();
+                }
+            }
+            bench_lat_add(lat, bench_now_ns() - t0, m);
+            sink += sum;
+        }
+        bench_perf_stop(perf);
+    }
+}
+
+template <typename C>
+static void bench_traverse(C &c, size_t n, bench_lat *lat, bench_perf *perf) {
+    fill(c, n);
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        uintptr_t sum = 0;
+        for (void *v : c) sum += reinterpret_cast<uintptr_t>(v);
+        bench_lat_add(lat, bench_now_ns() - t0, n);
+        bench_perf_stop(perf);
+        sink += sum;
+    }
+    c.clear();
+}
+
+template <typename C>
+static void bench_clear(C &c, size_t n, bench_lat *lat, bench_perf *perf) {
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        fill(c, n);
+        bench_perf_start(perf);
+        uint64_t t0 = bench_now_ns();
+        c.clear();
+        bench_lat_add(lat, bench_now_ns() - t0, n);
+        bench_perf_stop(perf);
+    }
+}
+
+template <typename C>
+static void bench_find(C &c, size_t n, std::mt19937_64 &rng, bench_lat *lat, bench_perf *perf) {
+    size_t finds = std::max<size_t>(4, (size_t(1) << 25) / n);
+    size_t batch = n >= 4096 ? 1 : BENCH_BATCH;
+    fill(c, n);
+    bench_perf_start(perf);
+    for (size_t i = 0; i < finds; i += batch) {
+        size_t m = std::min(batch, finds - i);
+        uintptr_t sum = 0;
+        uint64_t t0 = bench_now_ns();
+        for (size_t j = 0; j < m; ++j) {
+            auto it = std::find(c.begin(), c.end(), VAL(rng() % n));
+            sum += it != c.end();
+        }
+        bench_lat_add(lat, bench_now_ns() - t0, m);
+        sink += sum;
+    }
+    bench_perf_stop(perf);
+    c.clear();
+}
+
+/* std::list only: erase by iterator in random order */
+static void bench_remove(std::list<void *> &c, size_t n, std::mt19937_64 &rng,
+                         bench_lat *lat, bench_perf *perf) {
+    std::vector<std::list<void *>::iterator> handles;
+    for (size_t r = bench_reps(n); r > 0; --r) {
+        fill(c, n);
+        handles.clear();
+        for (auto it = c.begin(); it != c.end(); ++it) handles.push_back(it);
+        std::shuffle(handles.begin(), handles.end(), rng);
+        bench_perf_start(perf);
+        for (size_t i = 0; i < handles.size(); i += BENCH_BATCH) {
+            size_t m = std::min<size_t>(BENCH_BATCH, handles.size() - i);
+            uint64_t t0 = bench_now_ns();
+            for (size_t j = 0; j < m; ++j) c.erase(handles[i + j]);
+            bench_lat_add(lat, bench_now_ns() - t0, m);
+        }
+        bench_perf_stop(perf);
+    }
+}
+
+template <typename C>
+static void run_all(const char *name, size_t n, std::mt19937_64 &rng,
+                    bench_lat *lat, bench_perf *perf) {
+    C c;
+    bench_lat_reset(lat); perf->total = 0;
+    bench_push(c, n, true, lat, perf);
+    bench_report(name, "push_back", n, lat, perf);
+    bench_lat_reset(lat); perf->total = 0;
+    bench_push(c, n, false, lat, perf);
+    bench_report(name, "push_front", n, lat, perf);
+    bench_lat_reset(lat); perf->total = 0;
+    bench_pop(c, n, true, lat, perf);
+    bench_report(name, "pop_front", n, lat, perf);
+    bench_lat_reset(lat); perf->total = 0;
+    bench_pop(c, n, false, lat, perf);
+    bench_report(name, "pop_back", n, lat, perf);
+    bench_lat_reset(lat); perf->total = 0;
+    bench_traverse(c, n, lat, perf);
+    bench_report(name, "traverse", n, lat, perf);
+    bench_lat_reset(lat); perf->total = 0;
+    bench_clear(c, n, lat, perf);
+    bench_report(name, "clear", n, lat, perf);
+    bench_lat_reset(lat); perf->total = 0;
+    bench_find(c, n, rng, lat, perf);
+    bench_report(name, "find", n, lat, perf);
+}
+
+int main(int argc, char **argv) {
+    size_t max = bench_max_size(argc, argv);
+    bench_lat lat = {};
+    bench_perf perf;
+    std::mt19937_64 rng(88172645463325252u);
+    bench_perf_open(&perf);
+    if (perf.fd < 0) fprintf(stderr, "perf events unavailable: cache misses not reported\n");
+
+    bench_header();
+    for (size_t s = 0; s < BENCH_NSIZES && bench_sizes[s] <= max; ++s) {
+        size_t n = bench_sizes[s];
+        run_all<std::deque<void *>>("std::deque", n, rng, &lat, &perf);
+        run_all<std::list<void *>>("std::list", n, rng, &lat, &perf);
+        std::list<void *> l;
+        bench_lat_reset(&lat); perf.total = 0;
+        bench_remove(l, n, rng, &lat, &perf);
+        bench_report("std::list", "remove_node", n, &lat, &perf);
+    }
+    free(lat.ns);
+    return 0;
+}
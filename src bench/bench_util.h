@@ -0,0 +1,161 @@
+/*====================================
+ * File: bench_util.h
+ * Timing, latency percentiles and hardware cache-miss counters shared
+ * by the benchmark programs (C and C++).
+ * ===================================*/
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* Operations timed together to amortize the clock read */
+#define BENCH_BATCH 64
+
+/* Minimum number of operations per (container, op, size) measurement:
+   small sizes are repeated until this many ops were timed */
+#define BENCH_MIN_OPS (1u << 20)
+
+/* Default size ladder, capped by the command-line maximum */
+static const size_t bench_sizes[] = {64, 1024, 65536, 1048576, 10485760};
+#define BENCH_NSIZES (sizeof(bench_sizes) / sizeof(bench_sizes[0]))
+
+/* Monotonic clock in nanoseconds */
+static inline uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* ---------------------------
+   Hardware cache-miss counter (Linux perf events, optional)
+   --------------------------- */
+
+typedef struct {
+    int fd;          /* -1 when counters are unavailable */
+    uint64_t total;  /* misses accumulated while enabled */
+} bench_perf;
+
+static inline void bench_perf_open(bench_perf *p) {
+    p->fd = -1;
+    p->total = 0;
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    p->fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+static inline void bench_perf_start(bench_perf *p) {
+#ifdef __linux__
+    if (p->fd < 0) return;
+    ioctl(p->fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(p->fd, PERF_EVENT_IOC_ENABLE, 0);
+#else
+    (void)p;
+#endif
+}
+
+static inline void bench_perf_stop(bench_perf *p) {
+#ifdef __linux__
+    uint64_t count = 0;
+    if (p->fd < 0) return;
+    ioctl(p->fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(p->fd, &count, sizeof(count)) == (ssize_t)sizeof(count)) p->total += count;
+#else
+    (void)p;
+#endif
+}
+
+/* ---------------------------
+   Latency samples (per-op ns of each batch)
+   --------------------------- */
+
+typedef struct {
+    double *ns;
+    size_t count;
+    size_t cap;
+    uint64_t total_ns;
+    uint64_t ops;
+} bench_lat;
+
+static inline void bench_lat_reset(bench_lat *l) {
+    l->count = 0;
+    l->total_ns = 0;
+    l->ops = 0;
+}
+
+/* Record that ops operations took ns nanoseconds */
+static inline void bench_lat_add(bench_lat *l, uint64_t ns, uint64_t ops) {
+    if (ops == 0) return;
+    if (l->count == l->cap) {
+        size_t cap = l->cap ? l->cap * 2 : 4096;
+        double *grown = (double *)realloc(l->ns, cap * sizeof(double));
+        if (!grown) return;
+        l->ns = grown;
+        l->cap = cap;
+    }
+    l->ns[l->count++] = (double)ns / (double)ops;
+    l->total_ns += ns;
+    l->ops += ops;
+}
+
+static inline int bench_cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/* Column header matching bench_report() */
+static inline void bench_header(void) {
+    printf("container\top\tsize\tops_per_sec\tp50_ns\tp99_ns\tcache_misses_per_op\n");
+}
+
+/* Print one tab-separated result line */
+static inline void bench_report(const char *container, const char *op, size_t size,
+                                bench_lat *l, const bench_perf *p) {
+    if (l->ops == 0 || l->count == 0) return;
+    qsort(l->ns, l->count, sizeof(double), bench_cmp_double);
+    double p50 = l->ns[(l->count - 1) / 2];
+    double p99 = l->ns[(size_t)((double)(l->count - 1) * 0.99)];
+    double secs = (double)l->total_ns / 1e9;
+    printf("%s\t%s\t%zu\t%.0f\t%.1f\t%.1f\t", container, op, size,
+           secs > 0 ? (double)l->ops / secs : 0.0, p50, p99);
+    if (p->fd >= 0) {
+        printf("%.3f\n", (double)p->total / (double)l->ops);
+    } else {
+        printf("n/a\n");
+    }
+    fflush(stdout);
+}
+
+/* Parse the optional maximum size argument (default 1M) */
+static inline size_t bench_max_size(int argc, char **argv) {
+    size_t max = 1048576;
+    if (argc > 1) max = (size_t)strtoull(argv[1], NULL, 10);
+    return max;
+}
+
+/* Repetitions needed so that each measurement times BENCH_MIN_OPS ops */
+static inline size_t bench_reps(size_t n) {
+    return n >= BENCH_MIN_OPS ? 1 : BENCH_MIN_OPS / n;
+}
+
+#endif /* BENCH_UTIL_H */
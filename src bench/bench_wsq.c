@@ -0,0 +1,226 @@
+/* ==========================================
+ * bench_wsq.c
+ * Fork-join scheduler demo: per-worker task queues with stealing,
+ * run on the lock-free work-stealing deque (gmbwsq) and on the
+ * mutex-protected gllist queues it replaces.
+ *
+ * Build (from the repository root):
+ *   cc -std=c11 -O2 -D_GNU_SOURCE -pthread -Isrc "src bench/bench_wsq.c" \
+ *      src/gmbwsq.c src/gllist.c -o bench_wsq
+ * Run:
+ *   ./bench_wsq [max_threads] [depth]   (default: online CPUs, 20)
+ *
+ * Every task of depth d > 0 spawns two tasks of depth d - 1; leaves
+ * spin for a few hundred cycles. Owners push/pop at the back, idle
+ * workers steal from the front of a random victim.
+ * Output is tab-separated, one line per (scheduler, threads):
+ * tasks/sec, speedup over one thread of the same scheduler, steals.
+ * ========================================== */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "gllist.h"
+#include "gmbwsq.h"
+
+#define WSQ_SLOTS 4096  /* per worker, tasks beyond this run inline */
+#define LEAF_WORK 256   /* spin iterations per leaf task */
+
+/* Tasks are depth + 1 stored directly in the data pointer */
+#define TASK(depth)  ((void *)(uintptr_t)((depth) + 1))
+#define DEPTH(task)  ((unsigned)((uintptr_t)(task) - 1))
+
+typedef struct {
+    _Alignas(GMB_DLLIST_CACHE_LINE) gmbdll_WsDeque dq;
+    gmbdll_WsSlot slots[WSQ_SLOTS];
+    gllist list;
+    pthread_mutex_t lock;
+    _Alignas(GMB_DLLIST_CACHE_LINE) atomic_size_t done;  /* written by the owner only */
+    uint64_t steals;
+    uint32_t rng;
+    volatile uint32_t sink;  /* keeps the leaf work alive */
+    pthread_t thread;
+} worker;
+
+/* ---------------------------
+   Scheduler adapters
+   --------------------------- */
+
+typedef struct {
+    const char *name;
+    void (*init)(worker *w);
+    void (*destroy)(worker *w);
+    int (*push)(worker *w, void *task);
+    void *(*pop)(worker *w);
+    void *(*steal)(worker *victim);
+} bench_sched;
+
+static void wsq_init(worker *w) { gmbdll_wsdeque_init(&w->dq, w->slots, WSQ_SLOTS); }
+static void wsq_destroy(worker *w) { (void)w; }
+static int wsq_push(worker *w, void *task) { return gmbdll_wsdeque_push(&w->dq, task); }
+static void *wsq_pop(worker *w) {
+    void *task = NULL;
+    gmbdll_wsdeque_pop(&w->dq, &task);
+    return task;
+}
+static void *wsq_steal(worker *victim) {
+    void *task = NULL;
+    gmbdll_wsdeque_steal(&victim->dq, &task);
+    return task;
+}
+
+static void locked_init(worker *w) {
+    list_init(&w->list);
+    pthread_mutex_init(&w->lock, NULL);
+}
+static void locked_destroy(worker *w) {
+    list_destroy(&w->list);
+    pthread_mutex_destroy(&w->lock);
+}
+static int locked_push(worker *w, void *task) {
+    pthread_mutex_lock(&w->lock);
+    int rc = list_push_back(&w->list, task);
+    pthread_mutex_unlock(&w->lock);
+    return rc;
+}
+static void *locked_pop(worker *w) {
+    pthread_mutex_lock(&w->lock);
+    void *task = list_pop_back(&w->list);
+    pthread_mutex_unlock(&w->lock);
+    return task;
+}
+static void *locked_steal(worker *victim) {
+    pthread_mutex_lock(&victim->lock);
+    void *task = list_pop_front(&victim->list);
+    pthread_mutex_unlock(&victim->lock);
+    return task;
+}
+
+static const bench_sched scheds[] = {
+    {"gmbwsq", wsq_init, wsq_destroy, wsq_push, wsq_pop, wsq_steal},
+    {"gllist_mutex", locked_init, locked_destroy, locked_push, locked_pop, locked_steal},
+};
+
+/* ---------------------------
+   Scheduler
+   --------------------------- */
+
+static const bench_sched *sched;
+static worker *workers;
+static size_t nworkers;
+static size_t total_tasks;
+
+static void run_task(worker *w, void *task) {
+    unsigned depth = DEPTH(task);
+    size_t executed = 1;
+    while (depth > 0) {
+        /* keep one child, offer the other to thieves */
+        depth--;
+        if (sched->push(w, TASK(depth)) != 0) run_task(w, TASK(depth)); /* full */
+    }
+    uint32_t x = (uint32_t)(uintptr_t)task;
+    for (int i = 0; i < LEAF_WORK; ++i) x = x * 1664525u + 1013904223u;
+    w->sink = x;
+    /* one task per level was kept and run inline */
+    executed += DEPTH(task);
+    atomic_store_explicit(&w->done,
+                          atomic_load_explicit(&w->done, memory_order_relaxed) + executed,
+                          memory_order_relaxed);
+}
+
+static size_t tasks_done(void) {
+    size_t sum = 0;
+    for (size_t i = 0; i < nworkers; ++i) {
+        sum += atomic_load_explicit(&workers[i].done, memory_order_relaxed);
+    }
+    return sum;
+}
+
+static void *worker_main(void *arg) {
+    worker *w = (worker *)arg;
+    for (;;) {
+        void *task = sched->pop(w);
+        if (!task && nworkers > 1) {
+            w->rng ^= w->rng << 13;
+            w->rng ^= w->rng >> 17;
+            w->rng ^= w->rng << 5;
+            worker *victim = &workers[w->rng % nworkers];
+            if (victim != w && (task = sched->steal(victim)) != NULL) w->steals++;
+        }
+        if (task) {
+            run_task(w, task);
+        } else if (tasks_done() == total_tasks) {
+            break;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/* Run the task tree on n workers. Returns elapsed ns, steals in *steals */
+static uint64_t run(size_t n, unsigned depth, uint64_t *steals) {
+    nworkers = n;
+    total_tasks = ((size_t)2 << depth) - 1;
+    for (size_t i = 0; i < n; ++i) {
+        sched->init(&workers[i]);
+        atomic_init(&workers[i].done, 0);
+        workers[i].steals = 0;
+        workers[i].rng = (uint32_t)(2463534242u + 7919u * i);
+    }
+    sched->push(&workers[0], TASK(depth));
+
+    uint64_t t0 = bench_now_ns();
+    for (size_t i = 1; i < n; ++i) {
+        pthread_create(&workers[i].thread, NULL, worker_main, &workers[i]);
+    }
+    worker_main(&workers[0]);
+    for (size_t i = 1; i < n; ++i) pthread_join(workers[i].thread, NULL);
+    uint64_t elapsed = bench_now_ns() - t0;
+
+    *steals = 0;
+    for (size_t i = 0; i < n; ++i) {
+        *steals += workers[i].steals;
+        sched->destroy(&workers[i]);
+    }
+    return elapsed;
+}
+
+int main(int argc, char **argv) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max_threads = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10)
+                                  : (size_t)(cpus > 0 ? cpus : 1);
+    unsigned depth = argc > 2 ? (unsigned)strtoul(argv[2], NULL, 10) : 20;
+    if (max_threads == 0 || depth == 0 || depth >= WSQ_SLOTS) {
+        fprintf(stderr, "usage: %s [max_threads] [depth]\n", argv[0]);
+        return 1;
+    }
+    workers = (worker *)aligned_alloc(GMB_DLLIST_CACHE_LINE,
+                                      (max_threads * sizeof(worker) + GMB_DLLIST_CACHE_LINE - 1) /
+                                      GMB_DLLIST_CACHE_LINE * GMB_DLLIST_CACHE_LINE);
+    if (!workers) return 1;
+
+    printf("scheduler\tthreads\ttasks\ttasks_per_sec\tspeedup\tsteals\n");
+    for (size_t k = 0; k < sizeof(scheds) / sizeof(scheds[0]); ++k) {
+        sched = &scheds[k];
+        double base = 0;
+        for (size_t n = 1; n <= max_threads; n = n < max_threads && n * 2 > max_threads
+                                                    ? max_threads : n * 2) {
+            uint64_t steals;
+            uint64_t ns = run(n, depth, &steals);
+            double rate = (double)total_tasks / ((double)ns / 1e9);
+            if (n == 1) base = rate;
+            printf("%s\t%zu\t%zu\t%.0f\t%.2f\t%llu\n", sched->name, n, total_tasks, rate,
+                   rate / base, (unsigned long long)steals);
+            fflush(stdout);
+            if (n == max_threads) break;
+        }
+    }
+    free(workers);
+    return 0;
+}
@@ -0,0 +1,142 @@
+/* ==========================================
+ * test_gcllist.c
+ * Unit test for the two-lock concurrent deque
+ * Single-thread API checks, timeouts, then a
+ * bounded multi-producer/multi-consumer run
+ * ========================================== */
+
+#define _POSIX_C_SOURCE 200809L /* clock_gettime, nanosleep */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include <time.h>
+#include "gcllist.h"
+
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define ITEMS_PER_PRODUCER 50000
+#define CAPACITY 64
+
+static gcllist deque;
+static atomic_size_t consumed;
+static atomic_ullong checksum;
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/* Items encode (producer << 32 | sequence + 1) so NULL is never queued */
+static void *producer(void *arg) {
+    uintptr_t id = (uintptr_t)arg;
+    for (uintptr_t i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+        void *item = (void *)((id << 32) | (i + 1));
+        assert(clist_push_wait(&deque, item, -1) == 0);
+        assert(clist_size(&deque) <= CAPACITY);
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg) {
+    (void)arg;
+    uintptr_t last[PRODUCERS] = {0};
+    while (atomic_load(&consumed) < (size_t)PRODUCERS * ITEMS_PER_PRODUCER) {
+        void *item;
+        if (clist_pop_wait(&deque, &item, 10) != 0) {
+            continue; /* timed out, re-check for completion */
+        }
+        uintptr_t v = (uintptr_t)item;
+        uintptr_t id = v >> 32;
+        uintptr_t seq = v & 0xFFFFFFFFu;
+        assert(id < PRODUCERS);
+        assert(seq > last[id]); /* FIFO per producer */
+        last[id] = seq;
+        atomic_fetch_add(&checksum, seq);
+        atomic_fetch_add(&consumed, 1);
+    }
+    return NULL;
+}
+
+static void *late_producer(void *arg) {
+    struct timespec ts = {0, 20 * 1000000L};
+    nanosleep(&ts, NULL);
+    assert(clist_push_back(&deque, arg) == 0);
+    return NULL;
+}
+
+int main(void) {
+    printf("=== gcllist test start ===\n");
+
+    /* Test single-thread deque operations */
+    int a = 10, b = 20, c = 30;
+    void *out = NULL;
+    assert(clist_init(&deque, 0) == 0);
+    assert(clist_size(&deque) == 0);
+    assert(clist_pop_front(&deque) == NULL);
+    assert(clist_pop_back(&deque) == NULL);
+
+    assert(clist_push_back(&deque, &b) == 0);
+    assert(clist_push_front(&deque, &a) == 0);
+    assert(clist_push_back(&deque, &c) == 0);
+    assert(clist_size(&deque) == 3);
+    assert(clist_pop_back(&deque) == &c);
+    assert(clist_pop_front(&deque) == &a);
+    assert(clist_pop_back(&deque) == &b);
+    assert(clist_size(&deque) == 0);
+
+    /* push_front into an empty deque then pop from both ends */
+    assert(clist_push_front(&deque, &a) == 0);
+    assert(clist_push_back(&deque, &b) == 0);
+    assert(clist_pop_front(&deque) == &a);
+    assert(clist_pop_front(&deque) == &b);
+    clist_destroy(&deque);
+
+    /* Test capacity and timeouts */
+    assert(clist_init(&deque, 2) == 0);
+    assert(clist_push_back(&deque, &a) == 0);
+    assert(clist_push_front(&deque, &b) == 0);
+    assert(clist_push_back(&deque, &c) == -1);
+    assert(clist_push_front(&deque, &c) == -1);
+    double t0 = now_ms();
+    assert(clist_push_wait(&deque, &c, 30) == -1);
+    assert(now_ms() - t0 >= 25.0);
+    assert(clist_pop_wait(&deque, &out, 0) == 0 && out == &b);
+    assert(clist_push_wait(&deque, &c, 0) == 0);
+    assert(clist_pop_wait(&deque, &out, 0) == 0 && out == &a);
+    assert(clist_pop_wait(&deque, &out, 0) == 0 && out == &c);
+    t0 = now_ms();
+    assert(clist_pop_wait(&deque, &out, 30) == -1);
+    assert(now_ms() - t0 >= 25.0);
+
+    /* Test a waiting consumer is woken by a later push */
+    pthread_t late;
+    pthread_create(&late, NULL, late_producer, &a);
+    assert(clist_pop_wait(&deque, &out, -1) == 0 && out == &a);
+    pthread_join(late, NULL);
+    clist_destroy(&deque);
+
+    /* Test concurrent producers and consumers on a bounded deque */
+    assert(clist_init(&deque, CAPACITY) == 0);
+    pthread_t prod[PRODUCERS], cons[CONSUMERS];
+    for (uintptr_t i = 0; i < CONSUMERS; ++i) {
+        pthread_create(&cons[i], NULL, consumer, NULL);
+    }
+    for (uintptr_t i = 0; i < PRODUCERS; ++i) {
+        pthread_create(&prod[i], NULL, producer, (void *)i);
+    }
+    for (int i = 0; i < PRODUCERS; ++i) pthread_join(prod[i], NULL);
+    for (int i = 0; i < CONSUMERS; ++i) pthread_join(cons[i], NULL);
+
+    unsigned long long expected =
+        (unsigned long long)PRODUCERS * ITEMS_PER_PRODUCER * (ITEMS_PER_PRODUCER + 1) / 2;
+    assert(atomic_load(&checksum) == expected);
+    assert(clist_size(&deque) == 0);
+    clist_destroy(&deque);
+
+    printf("=== gcllist test passed ===\n");
+    return 0;
+}
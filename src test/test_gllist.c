@@ -2,6 +2,13 @@
 #include <stdlib.h>
 #include "gllist.h"
 
+// Comparison function for integers
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
 // -------------------------------------------------
 // Simple test program for the linked list library
 // -------------------------------------------------
@@ -45,5 +52,70 @@ int main(void) {
     printf("After destroy:\n");
     list_print_int(&list);
 
+    // test: slab-backed list (nodes recycled, chunks released at once)
+    gllist_slab slab;
+    gllist slist;
+    list_slab_init(&slab, 2);
+    list_init_slab(&slist, &slab);
+
+    list_push_back(&slist, &a);
+    list_push_back(&slist, &b);
+    list_push_back(&slist, &c);
+    list_push_front(&slist, &d);
+    printf("Slab list after pushes (d, a, b, c):\n");
+    list_print_int(&slist);
+
+    int *slab_val = (int *)list_pop_front(&slist);
+    if (slab_val != NULL) {
+        printf("Popped from slab front: %d\n", *slab_val);
+    }
+    list_push_back(&slist, &e);
+    list_print_int(&slist);
+
+    list_destroy(&slist);
+    list_push_back(&slist, &a);
+    printf("Slab list reused after destroy:\n");
+    list_print_int(&slist);
+
+    // test: batch push/pop, split and concat on the shared slab
+    gllist other;
+    void *items[4] = {&b, &c, &d, &e};
+    void *out[5];
+    list_push_back_n(&slist, items, 4);
+    list_split_at(&slist, slist.head->next->next, &other);
+    printf("After split at third element:\n");
+    list_print_int(&slist);
+    list_print_int(&other);
+    list_concat(&other, &slist);
+    printf("After concat (other + list):\n");
+    list_print_int(&other);
+    size_t popped = list_pop_front_n(&other, out, 5);
+    printf("Popped %zu elements in one call, first: %d\n", popped, *(int *)out[0]);
+
+    // test: sort and sorted insert
+    list_push_back_n(&other, out, popped);
+    list_sort(&other, cmp_int);
+    printf("After sort:\n");
+    list_print_int(&other);
+    int f = 35;
+    Node *hint = list_insert_sorted(&other, &f, cmp_int, NULL);
+    list_insert_sorted(&other, &a, cmp_int, hint);
+    printf("After sorted insert (35, 10):\n");
+    list_print_int(&other);
+
+#if GLLIST_STATS
+    // test: statistics dump
+    printf("Stats:\n");
+    list_stats_json(&other, "other", stdout);
+    list_slab_stats_json(&slab, "slab", stdout);
+#endif
+
+    list_destroy(&other);
+    list_destroy(&slist);
+#if GLLIST_STATS
+    list_slab_stats_json(&slab, "slab_after_destroy", stdout);
+#endif
+    list_slab_destroy(&slab);
+
     return 0;
 }
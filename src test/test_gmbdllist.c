@@ -7,6 +7,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include "gmbdllist.h"
 
 /* Comparison function for integers */
@@ -21,6 +24,70 @@ static void free_int(void *p) {
     free(p);
 }
 
+/* Hash function for integer keys */
+static size_t hash_int(const void *key) {
+    return (size_t)(*(const int *)key) * 2654435761u;
+}
+
+/* Block allocator for the growth policy, counts live blocks */
+static void *grow_alloc(size_t size, void *ctx) {
+    ++*(int *)ctx;
+    return malloc(size);
+}
+
+static void grow_free(void *ptr, void *ctx) {
+    --*(int *)ctx;
+    free(ptr);
+}
+
+/* Batch callback: sums the elements, stops after ctx[1] elements */
+static int sum_batch(void *const *items, size_t count, void *ctx) {
+    long *acc = (long *)ctx;
+    assert(count > 0 && count <= GMB_DLLIST_BATCH);
+    for (size_t i = 0; i < count; ++i) acc[0] += *(const int *)items[i];
+    return acc[1] > 0 && acc[0] >= acc[1];
+}
+
+/* Worker sharing a pool through its own magazine */
+#define MAG_THREADS 4
+#define MAG_ROUNDS 20000
+static gmbdll_Pool shared_pool;
+static gmbdll_Node shared_nodes[1024];
+
+static void *mag_worker(void *arg) {
+    gmbdll_Magazine mag;
+    gmbdll_List wlist;
+    void *out[8];
+    assert(gmbdll_magazine_init(&mag, &shared_pool) == gmbdll_OK);
+    gmbdll_list_init(&wlist, &shared_pool);
+    assert(gmbdll_list_set_magazine(&wlist, &mag) == gmbdll_OK);
+    for (int r = 0; r < MAG_ROUNDS; ++r) {
+        for (int i = 0; i < 1 + r % 40; ++i) {
+            assert(gmbdll_push_back(&wlist, arg) == gmbdll_OK);
+        }
+        while (gmbdll_pop_front_n(&wlist, out, 8) > 0) {
+            assert(out[0] == arg);
+        }
+    }
+    for (int i = 0; i < 100; ++i) assert(gmbdll_push_front(&wlist, arg) == gmbdll_OK);
+    gmbdll_list_clear(&wlist, NULL);
+    gmbdll_magazine_destroy(&mag);
+    return NULL;
+}
+
+/* Poll gmbdll_pool_used while the workers run: a worker list holds at
+   most 100 nodes, nodes moving between pool and magazines must not be
+   counted twice (or wrap the count) */
+static atomic_int mag_running;
+
+static void *mag_observer(void *arg) {
+    (void)arg;
+    while (atomic_load(&mag_running)) {
+        assert(gmbdll_pool_used(&shared_pool) <= MAG_THREADS * 100);
+    }
+    return NULL;
+}
+
 int main(void) {
     printf("=== gmbdllist test start ===\n");
 
@@ -96,6 +163,519 @@ int main(void) {
     assert(gmbdll_list_is_empty(&list) == 1);
     assert(gmbdll_pool_used(&pool) == 0);
 
+    /* Test traversal through the link accessors */
+    static int vals[5] = {1, 2, 3, 4, 5};
+    for (int i = 0; i < 5; ++i) gmbdll_push_back(&list, &vals[i]);
+    int expect = 1;
+    for (gmbdll_Node *n = gmbdll_list_head(&list); n; n = gmbdll_node_next(&list, n)) {
+        assert(*(int *)n->data == expect++);
+    }
+    expect = 5;
+    for (gmbdll_Node *n = gmbdll_list_tail(&list); n; n = gmbdll_node_prev(&list, n)) {
+        assert(*(int *)n->data == expect--);
+    }
+
+#if GMB_DLLIST_INDEX_LINKS
+    /* Test relocation: index links survive a plain memcpy of pool + list */
+    static gmbdll_Pool moved_pool;
+    gmbdll_List moved_list;
+    memcpy(&moved_pool, &pool, sizeof(pool));
+    memcpy(&moved_list, &list, sizeof(list));
+    moved_list.pool = &moved_pool;
+    for (int i = 1; i <= 5; ++i) {
+        assert(*(int *)gmbdll_pop_front(&moved_list) == i);
+    }
+    assert(gmbdll_pool_used(&moved_pool) == 0);
+#endif
+    gmbdll_list_clear(&list, NULL);
+    assert(gmbdll_pool_used(&pool) == 0);
+
+    /* Test batch push/pop, split, concat and splice */
+    void *items[5] = {&vals[0], &vals[1], &vals[2], &vals[3], &vals[4]};
+    void *out[5];
+    gmbdll_List other;
+    gmbdll_list_init(&other, &pool);
+    assert(gmbdll_push_back_n(&list, items, 5) == 5);
+    int key3 = 3;
+    gmbdll_Node *third = gmbdll_list_find(&list, cmp_int, &key3);
+    assert(gmbdll_list_split_at(&list, third, &other) == gmbdll_OK);
+    assert(gmbdll_list_size(&list) == 2 && gmbdll_list_size(&other) == 3);
+    assert(*(int *)gmbdll_list_tail(&list)->data == 2);
+    assert(*(int *)gmbdll_list_head(&other)->data == 3);
+    assert(gmbdll_list_concat(&other, &list) == gmbdll_OK); /* 3 4 5 1 2 */
+    assert(gmbdll_list_size(&list) == 0 && gmbdll_list_size(&other) == 5);
+    assert(gmbdll_pop_front_n(&other, out, 3) == 3);
+    assert(out[0] == &vals[2] && out[1] == &vals[3] && out[2] == &vals[4]);
+    assert(gmbdll_push_back_n(&list, out, 3) == 3);
+    assert(gmbdll_list_splice(&list, gmbdll_list_head(&list), &other) == gmbdll_OK);
+    assert(gmbdll_pool_used(&pool) == 5);
+    assert(gmbdll_pop_front_n(&list, out, 10) == 5);
+    for (int i = 0; i < 5; ++i) assert(out[i] == items[i]);
+    assert(gmbdll_list_is_empty(&list) && gmbdll_pool_used(&pool) == 0);
+
+    /* Test merge sort and sorted insert with hints */
+    static int rnd[GMB_DLLIST_MAX_NODES];
+    unsigned seed = 12345;
+    for (int i = 0; i < GMB_DLLIST_MAX_NODES / 2; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        rnd[i] = (int)((seed >> 16) % 100);
+        assert(gmbdll_push_back(&list, &rnd[i]) == gmbdll_OK);
+    }
+    gmbdll_list_sort(&list, cmp_int);
+    gmbdll_Node *hint = NULL;
+    for (int i = GMB_DLLIST_MAX_NODES / 2; i < GMB_DLLIST_MAX_NODES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        rnd[i] = (int)((seed >> 16) % 100);
+        hint = gmbdll_list_insert_sorted(&list, &rnd[i], cmp_int, hint);
+        assert(hint != NULL && hint->data == &rnd[i]);
+    }
+    assert(gmbdll_list_size(&list) == GMB_DLLIST_MAX_NODES);
+    size_t walked = 0;
+    for (gmbdll_Node *n = gmbdll_list_head(&list); n; n = gmbdll_node_next(&list, n)) {
+        gmbdll_Node *next = gmbdll_node_next(&list, n);
+        if (next) {
+            assert(cmp_int(n->data, next->data) <= 0);
+            assert(gmbdll_node_prev(&list, next) == n);
+        }
+        walked++;
+    }
+    assert(walked == GMB_DLLIST_MAX_NODES);
+    gmbdll_list_clear(&list, NULL);
+
+    /* Test hash index: kept in sync by push/pop/remove/clear */
+    static gmbdll_IndexSlot slots[4 * GMB_DLLIST_MAX_NODES];
+    gmbdll_Index index;
+    static int keys[GMB_DLLIST_MAX_NODES];
+    size_t nslots = 2;
+    while (nslots < 2 * GMB_DLLIST_MAX_NODES) nslots *= 2; /* power of two */
+    assert(gmbdll_index_init(&index, slots, nslots, NULL, hash_int, cmp_int) == gmbdll_OK);
+    for (int i = 0; i < GMB_DLLIST_MAX_NODES / 2; ++i) {
+        keys[i] = i * 7;
+        assert(gmbdll_push_back(&list, &keys[i]) == gmbdll_OK);
+    }
+    assert(gmbdll_list_attach_index(&list, &index) == gmbdll_OK);
+    for (int i = GMB_DLLIST_MAX_NODES / 2; i < GMB_DLLIST_MAX_NODES; ++i) {
+        keys[i] = i * 7;
+        assert(gmbdll_push_front(&list, &keys[i]) == gmbdll_OK);
+    }
+    for (int i = 0; i < GMB_DLLIST_MAX_NODES; ++i) {
+        int k = i * 7;
+        gmbdll_Node *n = gmbdll_list_find_key(&list, &k);
+        assert(n && n->data == &keys[i]);
+        int miss = k + 1;
+        assert(gmbdll_list_find_key(&list, &miss) == NULL);
+    }
+    /* remove every third key through the index, the rest by pop/remove_node */
+    for (int i = 0; i < GMB_DLLIST_MAX_NODES; i += 3) {
+        void *removed = NULL;
+        assert(gmbdll_list_remove_key(&list, &keys[i], &removed) == gmbdll_OK);
+        assert(removed == &keys[i]);
+        assert(gmbdll_list_find_key(&list, &keys[i]) == NULL);
+    }
+    int *popped_key = gmbdll_pop_front(&list);
+    assert(gmbdll_list_find_key(&list, popped_key) == NULL);
+    gmbdll_Node *tail_node = gmbdll_list_tail(&list);
+    int *tail_key = tail_node->data;
+    assert(gmbdll_list_remove_node(&list, tail_node, NULL) == gmbdll_OK);
+    assert(gmbdll_list_find_key(&list, tail_key) == NULL);
+    for (gmbdll_Node *n = gmbdll_list_head(&list); n; n = gmbdll_node_next(&list, n)) {
+        assert(gmbdll_list_find_key(&list, n->data) == n);
+    }
+    assert(index.count == gmbdll_list_size(&list));
+    assert(gmbdll_list_split_at(&list, gmbdll_list_head(&list), &other) == gmbdll_ERR);
+    gmbdll_list_clear(&list, NULL);
+    assert(index.count == 0);
+    assert(gmbdll_list_find_key(&list, &keys[1]) == NULL);
+    gmbdll_list_attach_index(&list, NULL);
+
+#if GMB_DLLIST_PAYLOAD_SIZE >= 8
+    /* Test inline payload: values live in the node, no boxing */
+    int pair[2] = {7, 70};
+    int back_pair[2] = {0, 0};
+    assert(gmbdll_push_back_copy(&list, pair, sizeof(pair)) == gmbdll_OK);
+    pair[0] = 8;
+    assert(gmbdll_push_front_copy(&list, pair, sizeof(pair)) == gmbdll_OK);
+    assert(gmbdll_push_back(&list, &vals[0]) == gmbdll_OK); /* pointer node */
+    int seven = 7;
+    gmbdll_Node *inl = gmbdll_list_find(&list, cmp_int, &seven);
+    assert(inl && inl->data == NULL && ((int *)gmbdll_node_value(inl))[1] == 70);
+    gmbdll_list_sort(&list, cmp_int); /* 1 7 8 */
+    assert(gmbdll_pop_back_copy(&list, back_pair, sizeof(back_pair)) == gmbdll_OK);
+    assert(back_pair[0] == 8 && back_pair[1] == 70);
+    assert(gmbdll_push_back_copy(&list, pair, GMB_DLLIST_PAYLOAD_SIZE + 1) == gmbdll_ERR);
+    gmbdll_pop_front(&list); /* pointer node vals[0] */
+    gmbdll_list_clear(&list, free_int); /* must not free the inline value */
+    assert(gmbdll_pool_used(&pool) == 0);
+#endif
+
+    /* Test pool on a caller buffer, then growth by chained blocks */
+    static gmbdll_Node buffer[3];
+    gmbdll_Pool bpool;
+    gmbdll_List blist;
+    int blocks = 0;
+    unsigned char pattern[sizeof(gmbdll_Node)];
+    memset(pattern, 0xA5, sizeof(pattern));
+    memset(buffer, 0xA5, sizeof(buffer));
+    assert(gmbdll_pool_init_buffer(&bpool, buffer, 3) == gmbdll_OK);
+    assert(gmbdll_pool_capacity(&bpool) == 3);
+    gmbdll_list_init(&blist, &bpool);
+    assert(gmbdll_push_back(&blist, &vals[0]) == gmbdll_OK);
+    /* lazy init: nodes past the high-water mark are never touched */
+    assert(memcmp(&buffer[1], pattern, sizeof(pattern)) == 0);
+    assert(memcmp(&buffer[2], pattern, sizeof(pattern)) == 0);
+    for (int i = 1; i < 3; ++i) assert(gmbdll_push_back(&blist, &vals[i]) == gmbdll_OK);
+    assert(gmbdll_push_back(&blist, &vals[3]) == gmbdll_ERR); /* fixed size */
+#if GMB_DLLIST_INDEX_LINKS || GMB_DLLIST_HANDLES
+    assert(gmbdll_pool_set_growth(&bpool, 2, grow_alloc, grow_free, &blocks) == gmbdll_ERR);
+#else
+    assert(gmbdll_pool_set_growth(&bpool, 2, grow_alloc, grow_free, &blocks) == gmbdll_OK);
+    for (int i = 3; i < 5; ++i) assert(gmbdll_push_back(&blist, &vals[i]) == gmbdll_OK);
+    assert(gmbdll_push_front(&blist, &vals[0]) == gmbdll_OK);
+    assert(blocks == 2);
+    assert(gmbdll_pool_capacity(&bpool) == 7);
+    assert(gmbdll_pool_used(&bpool) == 6);
+    assert(*(int *)gmbdll_pop_front(&blist) == 1);
+    for (int i = 1; i <= 5; ++i) assert(*(int *)gmbdll_pop_front(&blist) == i);
+#endif
+    gmbdll_list_clear(&blist, NULL);
+    gmbdll_pool_destroy(&bpool);
+    assert(blocks == 0);
+    assert(gmbdll_pool_capacity(&bpool) == 3);
+
+    /* Test magazines: used excludes cached nodes, batches come and go */
+    gmbdll_Magazine mag;
+    assert(gmbdll_pool_init_buffer(&shared_pool, shared_nodes, 1024) == gmbdll_OK);
+    assert(gmbdll_magazine_init(&mag, &shared_pool) == gmbdll_OK);
+    gmbdll_list_init(&blist, &shared_pool);
+    assert(gmbdll_list_set_magazine(&blist, &mag) == gmbdll_OK);
+    assert(gmbdll_list_set_magazine(&list, &mag) == gmbdll_ERR); /* other pool */
+    assert(gmbdll_push_back(&blist, &vals[0]) == gmbdll_OK);
+    assert(gmbdll_pool_used(&shared_pool) == 1);
+    assert(mag.count == GMB_DLLIST_MAGAZINE_SIZE / 2 - 1);
+    for (int i = 1; i < 100; ++i) assert(gmbdll_push_back(&blist, &vals[i % 5]) == gmbdll_OK);
+    assert(gmbdll_pool_used(&shared_pool) == 100);
+    gmbdll_list_split_at(&blist, gmbdll_node_next(&blist, gmbdll_list_head(&blist)), &other);
+    assert(other.mag == &mag && gmbdll_list_size(&other) == 99);
+    gmbdll_list_clear(&other, NULL);
+    assert(gmbdll_pool_used(&shared_pool) == 1);
+    assert(mag.count <= GMB_DLLIST_MAGAZINE_SIZE);
+    assert(*(int *)gmbdll_pop_front(&blist) == 1);
+    assert(gmbdll_pool_used(&shared_pool) == 0);
+    gmbdll_magazine_destroy(&mag);
+    assert(gmbdll_pool_used(&shared_pool) == 0);
+    assert(shared_pool.mags == NULL);
+
+    /* Test threads sharing one pool, each through its own magazine */
+    pthread_t workers[MAG_THREADS], observer;
+    atomic_store(&mag_running, 1);
+    pthread_create(&observer, NULL, mag_observer, NULL);
+    for (int i = 0; i < MAG_THREADS; ++i) {
+        pthread_create(&workers[i], NULL, mag_worker, &vals[i]);
+    }
+    for (int i = 0; i < MAG_THREADS; ++i) pthread_join(workers[i], NULL);
+    atomic_store(&mag_running, 0);
+    pthread_join(observer, NULL);
+    assert(gmbdll_pool_used(&shared_pool) == 0);
+    assert(shared_pool.mags == NULL);
+
+    /* Test iterators and batched traversal */
+    static int seq[50];
+    gmbdll_Iter it;
+    gmbdll_Node *n;
+    gmbdll_iter_begin(&it, &list);
+    assert(gmbdll_iter_next(&it) == NULL); /* empty */
+    for (int i = 0; i < 50; ++i) {
+        seq[i] = i;
+        assert(gmbdll_push_back(&list, &seq[i]) == gmbdll_OK);
+    }
+    expect = 0;
+    gmbdll_iter_begin(&it, &list);
+    while ((n = gmbdll_iter_next(&it)) != NULL) assert(*(int *)gmbdll_node_value(n) == expect++);
+    assert(expect == 50);
+    gmbdll_iter_rbegin(&it, &list);
+    while ((n = gmbdll_iter_next(&it)) != NULL) assert(*(int *)gmbdll_node_value(n) == --expect);
+    assert(expect == 0);
+    /* removing the returned node keeps the iterator valid */
+    gmbdll_iter_begin(&it, &list);
+    while ((n = gmbdll_iter_next(&it)) != NULL) {
+        if (*(int *)n->data % 2) gmbdll_list_remove_node(&list, n, NULL);
+    }
+    assert(gmbdll_list_size(&list) == 25);
+    long acc[2] = {0, 0};
+    assert(gmbdll_list_for_each_batch(&list, sum_batch, acc) == 25);
+    assert(acc[0] == 600); /* 0 + 2 + ... + 48 */
+    acc[0] = 0;
+    acc[1] = 1; /* stop after the first batch */
+    assert(gmbdll_list_for_each_batch(&list, sum_batch, acc) ==
+           (25 < GMB_DLLIST_BATCH ? 25 : GMB_DLLIST_BATCH));
+    gmbdll_list_clear(&list, NULL);
+    assert(gmbdll_list_for_each_batch(&list, sum_batch, acc) == 0);
+
+#if GMB_DLLIST_STATS
+    /* Test statistics counters and JSON dump */
+    gmbdll_Pool spool;
+    gmbdll_List slist;
+    static gmbdll_Node snodes[8];
+    static gmbdll_IndexSlot sslots[8];
+    gmbdll_Index sindex;
+    gmbdll_pool_init_buffer(&spool, snodes, 8);
+    gmbdll_list_init(&slist, &spool);
+    for (int i = 0; i < 5; ++i) assert(gmbdll_push_back(&slist, &vals[i]) == gmbdll_OK);
+    assert(gmbdll_list_find(&slist, cmp_int, &vals[3]) != NULL); /* 4 probes */
+    int absent = 99;
+    assert(gmbdll_list_find(&slist, cmp_int, &absent) == NULL); /* 5 probes */
+    assert(slist.stats.finds == 2 && slist.stats.find_probes == 9);
+    assert(slist.stats.find_hist[3] == 2); /* [4, 8) */
+    gmbdll_index_init(&sindex, sslots, 8, NULL, hash_int, cmp_int);
+    assert(gmbdll_list_attach_index(&slist, &sindex) == gmbdll_OK);
+    assert(gmbdll_list_find_key(&slist, &vals[0]) != NULL);
+    assert(slist.stats.key_finds == 1 && slist.stats.key_probes >= 1);
+    for (int i = 0; i < 5; ++i) gmbdll_push_back(&slist, &vals[i]); /* index fills up */
+    assert(slist.stats.insert_failures >= 1);
+    assert(slist.stats.inserts == gmbdll_list_size(&slist));
+    gmbdll_list_attach_index(&slist, NULL);
+    while (gmbdll_push_back(&slist, &vals[0]) == gmbdll_OK) {
+    }
+    assert(spool.stats.exhausted == 1 && spool.stats.peak_used == 8);
+    gmbdll_list_sort(&slist, cmp_int);
+    assert(slist.stats.sorts == 1 && slist.stats.peak_size == 8);
+    gmbdll_pop_front(&slist);
+    void *sout[3];
+    assert(gmbdll_pop_front_n(&slist, sout, 3) == 3);
+    assert(slist.stats.removes == 4);
+    assert(spool.stats.allocs - spool.stats.frees == gmbdll_pool_used(&spool));
+    assert(gmbdll_pool_stats_json(&spool, "spool", stdout) == gmbdll_OK);
+    assert(gmbdll_list_stats_json(&slist, "slist", stdout) == gmbdll_OK);
+    gmbdll_list_stats_reset(&slist);
+    assert(slist.stats.finds == 0 && slist.stats.peak_size == 4);
+    gmbdll_list_clear(&slist, NULL);
+    assert(slist.stats.removes == 4);
+#endif
+
+#if GMB_DLLIST_HANDLES
+    /* Test generation-checked handles and owner tags */
+    gmbdll_Pool hpool;
+    gmbdll_List ha, hb, hc;
+    static gmbdll_Node hnodes[8];
+    gmbdll_pool_init_buffer(&hpool, hnodes, 8);
+    gmbdll_list_init(&ha, &hpool);
+    gmbdll_list_init(&hb, &hpool);
+    gmbdll_list_init(&hc, &hpool);
+    for (int i = 0; i < 3; ++i) assert(gmbdll_push_back(&ha, &vals[i]) == gmbdll_OK);
+    gmbdll_Node *hn = gmbdll_list_tail(&ha);
+    gmbdll_Handle h = gmbdll_node_handle(&ha, hn);
+    assert(h.gen != 0 && gmbdll_handle_node(&ha, h) == hn);
+    assert(gmbdll_handle_node(&hb, h) == NULL); /* other list */
+    assert(gmbdll_node_handle(&hb, hn).gen == 0);
+    assert(gmbdll_list_remove_node(&hb, hn, NULL) == gmbdll_ERR);
+    assert(gmbdll_list_move_to_front(&hb, hn) == gmbdll_ERR);
+    gmbdll_Handle none = {0, 0, 0};
+    assert(gmbdll_handle_node(&ha, none) == NULL);
+    gmbdll_Handle far = {7, 1, ha.tag};
+    assert(gmbdll_handle_node(&ha, far) == NULL); /* never handed out */
+
+    /* Stale after pop: the raw pointer and the handle are both rejected,
+       also once the node is reused by the same list */
+    assert(gmbdll_pop_back(&ha) == &vals[2]);
+    assert(gmbdll_list_remove_node(&ha, hn, NULL) == gmbdll_ERR);
+    assert(gmbdll_list_remove_handle(&ha, h, NULL) == gmbdll_ERR);
+    assert(gmbdll_push_back(&ha, &vals[3]) == gmbdll_OK);
+    assert(gmbdll_list_tail(&ha) == hn); /* recycled */
+    assert(gmbdll_handle_node(&ha, h) == NULL);
+    h = gmbdll_node_handle(&ha, hn);
+    void *hout = NULL;
+    assert(gmbdll_list_remove_handle(&ha, h, &hout) == gmbdll_OK && hout == &vals[3]);
+    assert(gmbdll_list_remove_handle(&ha, h, NULL) == gmbdll_ERR);
+    assert(gmbdll_list_size(&ha) == 2);
+
+    /* Splice and split move ownership with the nodes; handles taken
+       before the move no longer resolve */
+    h = gmbdll_node_handle(&ha, gmbdll_list_head(&ha));
+    assert(gmbdll_list_concat(&hb, &ha) == gmbdll_OK);
+    assert(gmbdll_handle_node(&ha, h) == NULL);
+    assert(gmbdll_handle_node(&hb, h) == NULL);
+    h = gmbdll_node_handle(&hb, gmbdll_list_head(&hb));
+    assert(gmbdll_handle_node(&hb, h) == gmbdll_list_head(&hb));
+    assert(gmbdll_list_split_at(&hb, gmbdll_list_head(&hb), &hc) == gmbdll_OK);
+    assert(gmbdll_handle_node(&hb, h) == NULL);
+    assert(gmbdll_list_remove_handle(&hc, h, NULL) == gmbdll_ERR);
+    h = gmbdll_node_handle(&hc, gmbdll_list_head(&hc));
+    assert(gmbdll_list_remove_handle(&hc, h, NULL) == gmbdll_OK);
+    void *hbatch[1];
+    gmbdll_Node *hlast = gmbdll_list_head(&hc);
+    assert(gmbdll_pop_front_n(&hc, hbatch, 1) == 1);
+    assert(gmbdll_list_remove_node(&hc, hlast, NULL) == gmbdll_ERR);
+    assert(gmbdll_pool_used(&hpool) == 0);
+
+    /* Owner tags are unique across pools: the first list of another
+       pool does not accept this pool's nodes or handles */
+    gmbdll_Pool hpool2;
+    gmbdll_List hx, hy;
+    static gmbdll_Node hnodes2[8];
+    gmbdll_pool_init_buffer(&hpool, hnodes, 8);
+    gmbdll_pool_init_buffer(&hpool2, hnodes2, 8);
+    gmbdll_list_init(&hx, &hpool);
+    gmbdll_list_init(&hy, &hpool2);
+    assert(hx.tag != hy.tag);
+    assert(gmbdll_push_back(&hx, &vals[0]) == gmbdll_OK);
+    assert(gmbdll_push_back(&hy, &vals[1]) == gmbdll_OK);
+    assert(gmbdll_list_remove_node(&hx, gmbdll_list_head(&hy), NULL) == gmbdll_ERR);
+    assert(gmbdll_list_move_to_front(&hx, gmbdll_list_head(&hy)) == gmbdll_ERR);
+    h = gmbdll_node_handle(&hy, gmbdll_list_head(&hy));
+    assert(gmbdll_handle_node(&hx, h) == NULL); /* same index and generation */
+    assert(gmbdll_list_remove_handle(&hx, h, NULL) == gmbdll_ERR);
+    assert(gmbdll_list_size(&hx) == 1 && gmbdll_list_size(&hy) == 1);
+    gmbdll_list_clear(&hx, NULL);
+    gmbdll_list_clear(&hy, NULL);
+#endif
+
+    /* Test per-list quotas and reservations */
+    gmbdll_Pool qpool;
+    gmbdll_List qa, qb, qc, qd;
+    static gmbdll_Node qnodes[16];
+    gmbdll_pool_init_buffer(&qpool, qnodes, 16);
+    gmbdll_list_init(&qa, &qpool);
+    gmbdll_list_init(&qb, &qpool);
+    gmbdll_list_init(&qc, &qpool);
+    gmbdll_list_init(&qd, &qpool);
+    assert(gmbdll_list_set_quota(&qa, 5, 4) == gmbdll_ERR); /* reserve > quota */
+    assert(gmbdll_list_set_quota(&qa, 4, 0) == gmbdll_OK);
+    assert(gmbdll_list_set_quota(&qb, 0, 3) == gmbdll_OK);
+    for (int i = 0; i < 3; ++i) assert(gmbdll_push_back(&qb, &vals[i]) == gmbdll_OK);
+    assert(gmbdll_push_back(&qb, &vals[3]) == gmbdll_ERR); /* quota */
+    int taken = 0;
+    while (gmbdll_push_back(&qc, &vals[0]) == gmbdll_OK) taken++; /* runaway list */
+    assert(taken == 16 - 3 - 4);
+    for (int i = 0; i < 4; ++i) assert(gmbdll_push_back(&qa, &vals[i]) == gmbdll_OK);
+    assert(gmbdll_push_back(&qa, &vals[4]) == gmbdll_ERR); /* pool empty */
+    assert(gmbdll_pool_used(&qpool) == 16 && qpool.reserved == 0);
+    /* freed reserved nodes stay reserved */
+    assert(gmbdll_pop_front(&qa) == &vals[0]);
+    void *qout[1];
+    assert(gmbdll_pop_front_n(&qa, qout, 1) == 1);
+    assert(qpool.reserved == 2);
+    assert(gmbdll_push_back(&qc, &vals[0]) == gmbdll_ERR);
+    assert(gmbdll_list_set_quota(&qb, 10, 0) == gmbdll_ERR); /* cannot cover */
+    assert(gmbdll_push_front(&qa, &vals[1]) == gmbdll_OK);
+    /* splice respects the quota of dst and moves the charge */
+    gmbdll_list_clear(&qb, NULL);
+    assert(gmbdll_push_back(&qd, &vals[0]) == gmbdll_OK);
+    assert(gmbdll_push_back(&qd, &vals[1]) == gmbdll_OK);
+    assert(gmbdll_list_set_quota(&qb, 0, 1) == gmbdll_OK);
+    assert(gmbdll_list_concat(&qb, &qd) == gmbdll_ERR);
+    assert(gmbdll_list_set_quota(&qb, 0, 2) == gmbdll_OK);
+    assert(gmbdll_list_concat(&qb, &qd) == gmbdll_OK);
+    assert(gmbdll_push_back(&qb, &vals[2]) == gmbdll_ERR);
+    gmbdll_list_clear(&qc, NULL);
+    assert(gmbdll_list_concat(&qd, &qa) == gmbdll_OK); /* qa gives back its nodes */
+    assert(qpool.reserved == 4);
+    /* split_at refuses an out with limits (and keeps them intact) */
+    size_t qd_size = gmbdll_list_size(&qd);
+    gmbdll_list_clear(&qb, NULL);
+    assert(gmbdll_list_split_at(&qd, gmbdll_list_head(&qd), &qb) == gmbdll_ERR); /* quota */
+    assert(gmbdll_list_set_quota(&qb, 2, 2) == gmbdll_OK);
+    assert(qpool.reserved == 6);
+    assert(gmbdll_list_split_at(&qd, gmbdll_list_head(&qd), &qb) == gmbdll_ERR); /* reservation */
+    assert(qpool.reserved == 6 && qb.reserve == 2 && qb.quota == 2);
+    assert(gmbdll_list_size(&qd) == qd_size && gmbdll_list_size(&qb) == 0);
+    assert(gmbdll_list_set_quota(&qb, 0, 0) == gmbdll_OK);
+    assert(qpool.reserved == 4);
+    gmbdll_list_clear(&qd, NULL);
+    gmbdll_list_clear(&qb, NULL);
+    assert(gmbdll_list_set_quota(&qa, 0, 0) == gmbdll_OK);
+    assert(qpool.reserved == 0 && gmbdll_pool_used(&qpool) == 0);
+    /* moving nodes out of a reserved list in a full pool would promise
+       nodes that do not exist */
+    gmbdll_pool_init_buffer(&qpool, qnodes, 10);
+    assert(gmbdll_list_set_quota(&qa, 5, 0) == gmbdll_OK);
+    for (int i = 0; i < 5; ++i) assert(gmbdll_push_back(&qa, &vals[0]) == gmbdll_OK);
+    for (int i = 0; i < 5; ++i) assert(gmbdll_push_back(&qb, &vals[0]) == gmbdll_OK);
+    assert(gmbdll_list_concat(&qb, &qa) == gmbdll_ERR);
+    assert(gmbdll_list_split_at(&qa, gmbdll_list_tail(&qa), &qc) == gmbdll_ERR);
+    assert(gmbdll_list_size(&qa) == 5 && gmbdll_list_size(&qb) == 5 && qpool.reserved == 0);
+    assert(gmbdll_pop_front(&qb) == &vals[0]); /* one free node */
+    assert(gmbdll_list_split_at(&qa, gmbdll_list_tail(&qa), &qc) == gmbdll_OK);
+    assert(qpool.reserved == 1 && gmbdll_push_back(&qa, &vals[0]) == gmbdll_OK);
+    assert(gmbdll_list_concat(&qb, &qa) == gmbdll_ERR);
+    gmbdll_list_clear(&qb, NULL);
+    gmbdll_list_clear(&qc, NULL);
+    assert(gmbdll_list_concat(&qb, &qa) == gmbdll_OK);
+    assert(qpool.reserved == 5);
+    gmbdll_list_clear(&qb, NULL);
+    assert(gmbdll_list_set_quota(&qa, 0, 0) == gmbdll_OK);
+    assert(qpool.reserved == 0 && gmbdll_pool_used(&qpool) == 0);
+
+    /* Test compaction refuses a list given twice, which would make up
+       for a missing one in the node count */
+    for (int i = 0; i < 2; ++i) {
+        assert(gmbdll_push_back(&qa, &vals[i]) == gmbdll_OK);
+        assert(gmbdll_push_back(&qb, &vals[2 + i]) == gmbdll_OK);
+    }
+    gmbdll_List *const twice[2] = {&qa, &qa};
+    assert(gmbdll_pool_compact(&qpool, twice, 2) == gmbdll_ERR);
+    assert(gmbdll_list_size(&qb) == 2 && gmbdll_list_head(&qb)->data == &vals[2]);
+    gmbdll_list_clear(&qa, NULL);
+    gmbdll_list_clear(&qb, NULL);
+
+    /* Test compaction: two interleaved lists with holes end up
+       contiguous, in list order */
+    gmbdll_Pool cpool;
+    gmbdll_List ca, cb;
+    static gmbdll_Node cnodes[4096];
+    static int cvals[2000];
+    static gmbdll_IndexSlot cslots[2048];
+    gmbdll_Index cindex;
+    gmbdll_pool_init_buffer(&cpool, cnodes, 4096);
+    gmbdll_list_init(&ca, &cpool);
+    gmbdll_list_init(&cb, &cpool);
+    for (int i = 0; i < 1000; ++i) {
+        cvals[i] = i;
+        cvals[1000 + i] = 1000 + i;
+        assert(gmbdll_push_back(&ca, &cvals[i]) == gmbdll_OK);
+        assert(gmbdll_push_front(&cb, &cvals[1000 + i]) == gmbdll_OK);
+    }
+    gmbdll_iter_begin(&it, &ca);
+    while ((n = gmbdll_iter_next(&it)) != NULL) {
+        if (*(int *)n->data % 3 == 0) gmbdll_list_remove_node(&ca, n, NULL);
+    }
+    gmbdll_index_init(&cindex, cslots, 2048, NULL, hash_int, cmp_int);
+    assert(gmbdll_list_attach_index(&cb, &cindex) == gmbdll_OK);
+#if GMB_DLLIST_HANDLES
+    gmbdll_Handle before = gmbdll_node_handle(&cb, gmbdll_list_head(&cb));
+#endif
+    gmbdll_List *const only_a[1] = {&ca};
+    assert(gmbdll_pool_compact(&cpool, only_a, 1) == gmbdll_ERR); /* cb missing */
+    gmbdll_List *const clists[2] = {&ca, &cb};
+    assert(gmbdll_pool_compact(&cpool, clists, 2) == gmbdll_OK);
+    assert(gmbdll_list_size(&ca) == 666 && gmbdll_list_size(&cb) == 1000);
+    assert(cpool.fresh == 1666 && gmbdll_pool_used(&cpool) == 1666);
+    gmbdll_Node *expect_node = cnodes;
+    expect = 1;
+    for (n = gmbdll_list_head(&ca); n; n = gmbdll_node_next(&ca, n)) {
+        assert(n == expect_node++ && *(int *)n->data == expect);
+        expect += (expect % 3 == 2) ? 2 : 1;
+    }
+    expect = 1999;
+    for (n = gmbdll_list_head(&cb); n; n = gmbdll_node_next(&cb, n)) {
+        assert(n == expect_node++ && *(int *)n->data == expect--);
+    }
+    assert(gmbdll_list_find_key(&cb, &cvals[1500]) == &cnodes[666 + 499]);
+    assert(gmbdll_list_remove_key(&cb, &cvals[1500], NULL) == gmbdll_OK);
+#if GMB_DLLIST_HANDLES
+    assert(gmbdll_handle_node(&cb, before) == NULL);
+    assert(gmbdll_list_remove_handle(&cb,
+           gmbdll_node_handle(&cb, gmbdll_list_head(&cb)), NULL) == gmbdll_OK);
+    assert(gmbdll_push_back(&ca, &cvals[0]) == gmbdll_OK);
+#endif
+    /* the never-used tail can be released and reused */
+    size_t trimmed = gmbdll_pool_trim(&cpool);
+    assert(trimmed <= (4096 - cpool.fresh) * sizeof(gmbdll_Node));
+    while (gmbdll_push_back(&ca, &cvals[0]) == gmbdll_OK) {
+    }
+    assert(gmbdll_pool_used(&cpool) == 4096);
+    gmbdll_list_clear(&ca, NULL);
+    gmbdll_list_clear(&cb, NULL);
+
     /* Test debug print on empty list */
     gmbdll_print_int(&list);
 
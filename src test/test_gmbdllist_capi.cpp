@@ -0,0 +1,60 @@
+/* ==========================================
+ * test_gmbdllist_capi.cpp
+ * Unit test: the C headers used from a C++ unit
+ * ========================================== */
+
+#include <cassert>
+#include <cstdio>
+
+extern "C" {
+#include "gmbdllist.h"
+#include "gmblru.h"
+#include "gmbtwheel.h"
+#include "gmbsnap.h"
+}
+
+static int fired;
+
+static void on_timer(gmbdll_Timer *, void *) {
+    fired++;
+}
+
+int main() {
+    std::printf("=== gmbdllist C API from C++ test start ===\n");
+    static gmbdll_Pool pool;
+    int vals[4] = {1, 2, 3, 4};
+
+    /* Test plain list use */
+    gmbdll_List list;
+    assert(gmbdll_pool_init(&pool) == gmbdll_OK);
+    assert(gmbdll_list_init(&list, &pool) == gmbdll_OK);
+    assert(gmbdll_push_back(&list, &vals[0]) == gmbdll_OK);
+    assert(gmbdll_push_back(&list, &vals[1]) == gmbdll_OK);
+    assert(gmbdll_pool_used(&pool) == 2);
+
+    /* Test a list behind a magazine: cached nodes do not count as used */
+    gmbdll_Magazine mag;
+    gmbdll_List cached;
+    assert(gmbdll_magazine_init(&mag, &pool) == gmbdll_OK);
+    assert(gmbdll_list_init(&cached, &pool) == gmbdll_OK);
+    assert(gmbdll_list_set_magazine(&cached, &mag) == gmbdll_OK);
+    assert(gmbdll_push_back(&cached, &vals[2]) == gmbdll_OK);
+    assert(gmbdll_pool_used(&pool) == 3);
+    assert(gmbdll_pop_front(&cached) == &vals[2]);
+    assert(gmbdll_pool_used(&pool) == 2);
+    gmbdll_magazine_destroy(&mag);
+    assert(gmbdll_pool_used(&pool) == 2);
+    gmbdll_list_clear(&list, NULL);
+
+    /* Test the timer wheel on the same pool */
+    gmbdll_TimerWheel wheel;
+    gmbdll_Timer timer;
+    assert(gmbdll_twheel_init(&wheel, &pool, 0) == gmbdll_OK);
+    gmbdll_timer_init(&timer, &vals[3]);
+    assert(gmbdll_twheel_schedule(&wheel, &timer, 5) == gmbdll_OK);
+    assert(gmbdll_twheel_advance(&wheel, 5, on_timer, NULL) == 1);
+    assert(fired == 1 && gmbdll_pool_used(&pool) == 0);
+
+    std::printf("=== gmbdllist C API from C++ test passed ===\n");
+    return 0;
+}
@@ -0,0 +1,72 @@
+/* ==========================================
+ * test_gmbdllist_cpp.cpp
+ * Unit test for the C++ template wrapper
+ * ========================================== */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <string>
+#include "gmbdllist.hpp"
+
+int main() {
+    std::printf("=== gmbdllist.hpp test start ===\n");
+
+    /* Test values stored in place, push/pop at both ends */
+    gmbdll::List<int, 8> list;
+    assert(list.empty() && list.capacity() == 8);
+    assert(list.push_back(20));
+    assert(list.push_back(30));
+    assert(list.push_front(10));
+    assert(list.size() == 3 && list.front() == 10 && list.back() == 30);
+
+    /* Test STL algorithms through the iterators */
+    assert(std::accumulate(list.begin(), list.end(), 0) == 60);
+    assert(std::find(list.begin(), list.end(), 20) != list.end());
+    assert(*std::prev(list.end()) == 30);
+    assert(*list.rbegin() == 30);
+    assert(list.find(30) != list.end());
+    assert(list.find_if([](int v) { return v > 100; }) == list.end());
+
+    /* Test erase and exhaustion */
+    list.erase(list.find(20));
+    assert(list.size() == 2);
+    while (list.push_back(1)) {
+    }
+    assert(list.full() && list.size() == 8);
+    int out = 0;
+    assert(list.pop_front(out) && out == 10);
+    assert(list.emplace_back(5) != nullptr);
+
+    /* Test sort with a functor */
+    list.sort();
+    assert(std::is_sorted(list.begin(), list.end()));
+    list.sort(std::greater<>());
+    assert(std::is_sorted(list.rbegin(), list.rend()));
+    list.clear();
+    assert(list.empty() && list.pool_used() == 0);
+
+    /* Test non-trivial and move-only types */
+    gmbdll::List<std::string, 4> names;
+    names.emplace_back(3, 'x');
+    names.emplace_front("head");
+    names.move_to_front(names.find("xxx"));
+    assert(names.front() == "xxx" && names.back() == "head");
+    gmbdll::List<std::string, 4> copy = names;
+    gmbdll::List<std::string, 4> moved = std::move(copy);
+    assert(moved.size() == 2 && copy.empty());
+
+    gmbdll::List<std::unique_ptr<int>, 4> owners;
+    owners.push_back(std::make_unique<int>(42));
+    std::unique_ptr<int> taken;
+    assert(owners.pop_back(taken) && *taken == 42);
+    int cleared = 0;
+    owners.emplace_back(new int(1));
+    owners.clear([&](std::unique_ptr<int> &) { ++cleared; });
+    assert(cleared == 1);
+
+    std::printf("=== gmbdllist.hpp test passed ===\n");
+    return 0;
+}
@@ -0,0 +1,106 @@
+/* ==========================================
+ * test_gmbdlq.c
+ * Unit test for the lock-free MPMC queue
+ * Single-thread API checks, then a
+ * multi-producer/multi-consumer stress run
+ * ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include "gmbdlq.h"
+
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define ITEMS_PER_PRODUCER 200000
+
+static gmbdll_QPool pool;
+static gmbdll_Queue queue;
+static atomic_size_t consumed;
+static atomic_ullong checksum;
+
+/* Items encode (producer << 32 | sequence + 1) so NULL is never queued */
+static void *producer(void *arg) {
+    uintptr_t id = (uintptr_t)arg;
+    for (uintptr_t i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+        void *item = (void *)((id << 32) | (i + 1));
+        while (gmbdll_queue_push(&queue, item) != gmbdll_OK) {
+            sched_yield(); /* pool exhausted, wait for consumers */
+        }
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg) {
+    (void)arg;
+    uintptr_t last[PRODUCERS] = {0};
+    while (atomic_load(&consumed) < (size_t)PRODUCERS * ITEMS_PER_PRODUCER) {
+        void *item;
+        if (gmbdll_queue_pop(&queue, &item) != gmbdll_OK) {
+            sched_yield();
+            continue;
+        }
+        uintptr_t v = (uintptr_t)item;
+        uintptr_t id = v >> 32;
+        uintptr_t seq = v & 0xFFFFFFFFu;
+        assert(id < PRODUCERS);
+        assert(seq > last[id]); /* FIFO per producer */
+        last[id] = seq;
+        atomic_fetch_add(&checksum, seq);
+        atomic_fetch_add(&consumed, 1);
+    }
+    return NULL;
+}
+
+int main(void) {
+    printf("=== gmbdlq test start ===\n");
+
+    /* Test init */
+    assert(gmbdll_qpool_init(&pool) == gmbdll_OK);
+    assert(gmbdll_qpool_capacity(&pool) == GMB_DLLIST_MAX_NODES);
+    assert(gmbdll_queue_init(&queue, &pool) == gmbdll_OK);
+    assert(gmbdll_qpool_used(&pool) == 1); /* dummy node */
+    assert(gmbdll_queue_is_empty(&queue) == 1);
+
+    /* Test single-thread FIFO */
+    int a = 10, b = 20;
+    void *out = NULL;
+    assert(gmbdll_queue_pop(&queue, &out) == gmbdll_ERR);
+    assert(gmbdll_queue_push(&queue, &a) == gmbdll_OK);
+    assert(gmbdll_queue_push(&queue, &b) == gmbdll_OK);
+    assert(gmbdll_queue_is_empty(&queue) == 0);
+    assert(gmbdll_queue_pop(&queue, &out) == gmbdll_OK && out == &a);
+    assert(gmbdll_queue_pop(&queue, &out) == gmbdll_OK && out == &b);
+    assert(gmbdll_queue_is_empty(&queue) == 1);
+    assert(gmbdll_qpool_used(&pool) == 1);
+
+    /* Test exhaustion */
+    size_t pushed = 0;
+    while (gmbdll_queue_push(&queue, &a) == gmbdll_OK) pushed++;
+    assert(pushed == GMB_DLLIST_MAX_NODES - 1);
+    while (gmbdll_queue_pop(&queue, &out) == gmbdll_OK) pushed--;
+    assert(pushed == 0);
+
+    /* Test concurrent producers and consumers */
+    pthread_t prod[PRODUCERS], cons[CONSUMERS];
+    for (uintptr_t i = 0; i < CONSUMERS; ++i) {
+        pthread_create(&cons[i], NULL, consumer, NULL);
+    }
+    for (uintptr_t i = 0; i < PRODUCERS; ++i) {
+        pthread_create(&prod[i], NULL, producer, (void *)i);
+    }
+    for (int i = 0; i < PRODUCERS; ++i) pthread_join(prod[i], NULL);
+    for (int i = 0; i < CONSUMERS; ++i) pthread_join(cons[i], NULL);
+
+    unsigned long long expected =
+        (unsigned long long)PRODUCERS * ITEMS_PER_PRODUCER * (ITEMS_PER_PRODUCER + 1) / 2;
+    assert(atomic_load(&checksum) == expected);
+    assert(gmbdll_queue_is_empty(&queue) == 1);
+    assert(gmbdll_qpool_used(&pool) == 1);
+
+    printf("=== gmbdlq test passed ===\n");
+    return 0;
+}
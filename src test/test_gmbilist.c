@@ -0,0 +1,89 @@
+/* ==========================================
+ * test_gmbilist.c
+ * Unit test for the intrusive list
+ * ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "gmbilist.h"
+
+/* User struct carrying its own link */
+typedef struct {
+    int value;
+    gmbdll_ILink link;
+} Item;
+
+#define ITEM(l) GMBDLL_CONTAINER_OF(l, Item, link)
+
+static int cmp_item(const gmbdll_ILink *item, const void *key) {
+    return ITEM(item)->value != *(const int *)key;
+}
+
+static int released;
+
+static void release_item(gmbdll_ILink *link) {
+    (void)link;
+    released++;
+}
+
+int main(void) {
+    printf("=== gmbilist test start ===\n");
+
+    gmbdll_IList list, other;
+    Item items[5];
+    for (int i = 0; i < 5; ++i) items[i].value = (i + 1) * 10;
+
+    /* Test init */
+    assert(gmbdll_ilist_init(&list) == gmbdll_OK);
+    assert(gmbdll_ilist_init(&other) == gmbdll_OK);
+    assert(gmbdll_ilist_is_empty(&list) == 1);
+
+    /* Test push and container-of access */
+    assert(gmbdll_ilist_push_back(&list, &items[1].link) == gmbdll_OK);
+    assert(gmbdll_ilist_push_back(&list, &items[2].link) == gmbdll_OK);
+    assert(gmbdll_ilist_push_front(&list, &items[0].link) == gmbdll_OK);
+    assert(gmbdll_ilist_size(&list) == 3);
+    assert(ITEM(list.head)->value == 10);
+    assert(ITEM(list.tail)->value == 30);
+
+    /* Test find and remove */
+    int key = 20;
+    gmbdll_ILink *found = gmbdll_ilist_find(&list, cmp_item, &key);
+    assert(found == &items[1].link);
+    assert(gmbdll_ilist_remove(&list, found) == gmbdll_OK);
+    assert(gmbdll_ilist_size(&list) == 2);
+    assert(gmbdll_ilist_find(&list, cmp_item, &key) == NULL);
+
+    /* Test pop */
+    assert(ITEM(gmbdll_ilist_pop_front(&list))->value == 10);
+    assert(ITEM(gmbdll_ilist_pop_back(&list))->value == 30);
+    assert(gmbdll_ilist_pop_back(&list) == NULL);
+
+    /* Test split, concat and splice */
+    for (int i = 0; i < 5; ++i) gmbdll_ilist_push_back(&list, &items[i].link);
+    assert(gmbdll_ilist_split_at(&list, &items[2].link, &other) == gmbdll_OK);
+    assert(gmbdll_ilist_size(&list) == 2 && gmbdll_ilist_size(&other) == 3);
+    /* a non-empty out is refused, both lists unchanged */
+    assert(gmbdll_ilist_split_at(&list, list.tail, &other) == gmbdll_ERR);
+    assert(gmbdll_ilist_size(&list) == 2 && gmbdll_ilist_size(&other) == 3);
+    assert(gmbdll_ilist_concat(&other, &list) == gmbdll_OK); /* 30 40 50 10 20 */
+    assert(gmbdll_ilist_is_empty(&list));
+    gmbdll_ilist_push_back(&list, gmbdll_ilist_pop_front(&other));
+    assert(gmbdll_ilist_splice(&list, list.head, &other) == gmbdll_OK);
+    int expect[5] = {40, 50, 10, 20, 30};
+    int i = 0;
+    for (gmbdll_ILink *l = list.head; l; l = l->next) {
+        assert(ITEM(l)->value == expect[i++]);
+        if (l->next) assert(l->next->prev == l);
+    }
+    assert(i == 5);
+
+    /* Test clear with release callback */
+    gmbdll_ilist_clear(&list, release_item);
+    assert(released == 5);
+    assert(gmbdll_ilist_is_empty(&list));
+
+    printf("=== gmbilist test passed ===\n");
+    return 0;
+}
@@ -0,0 +1,94 @@
+/* ==========================================
+ * test_gmblru.c
+ * Unit test for the LRU cache on gmbdllist
+ * ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "gmblru.h"
+
+typedef struct {
+    int key;
+    int value;
+} Entry;
+
+static const void *entry_key(const void *data) {
+    return &((const Entry *)data)->key;
+}
+
+static size_t hash_int(const void *key) {
+    return (size_t)(*(const int *)key) * 2654435761u;
+}
+
+static int cmp_entry(const void *item, const void *key) {
+    return ((const Entry *)item)->key != *(const int *)key;
+}
+
+/* Eviction callback: remember the last evicted key */
+static void on_evict(void *data, void *ctx) {
+    *(int *)ctx = ((Entry *)data)->key;
+}
+
+int main(void) {
+    printf("=== gmblru test start ===\n");
+
+    static gmbdll_Node nodes[3];
+    static gmbdll_IndexSlot slots[8];
+    gmbdll_Pool pool;
+    gmbdll_Lru lru;
+    int evicted = -1;
+    Entry e[5] = {{1, 10}, {2, 20}, {3, 30}, {4, 40}, {1, 11}};
+
+    /* Test init: capacity follows the pool */
+    assert(gmbdll_pool_init_buffer(&pool, nodes, 3) == gmbdll_OK);
+    assert(gmbdll_lru_init(&lru, &pool, slots, 8, entry_key, hash_int, cmp_entry,
+                           on_evict, &evicted) == gmbdll_OK);
+    assert(lru.capacity == 3);
+
+    /* Test put / get */
+    assert(gmbdll_lru_put(&lru, &e[0], NULL) == gmbdll_OK);
+    assert(gmbdll_lru_put(&lru, &e[1], NULL) == gmbdll_OK);
+    assert(gmbdll_lru_put(&lru, &e[2], NULL) == gmbdll_OK);
+    int k = 1;
+    assert(gmbdll_lru_get(&lru, &k) == &e[0]); /* 1 becomes most recent */
+    k = 9;
+    assert(gmbdll_lru_get(&lru, &k) == NULL);
+    assert(gmbdll_lru_hits(&lru) == 1 && gmbdll_lru_misses(&lru) == 1);
+
+    /* Test a failed init leaves a live cache alone */
+    static gmbdll_Pool empty_pool; /* capacity 0 */
+    assert(gmbdll_lru_init(&lru, &empty_pool, slots, 8, entry_key, hash_int, cmp_entry,
+                           on_evict, &evicted) == gmbdll_ERR);
+    assert(lru.list.pool == &pool && lru.list.index == &lru.index);
+    assert(gmbdll_lru_size(&lru) == 3 && lru.index.count == 3);
+
+    /* Test eviction of the least recent entry (2) */
+    assert(gmbdll_lru_put(&lru, &e[3], NULL) == gmbdll_OK);
+    assert(evicted == 2);
+    assert(gmbdll_lru_evictions(&lru) == 1);
+    assert(gmbdll_lru_size(&lru) == 3);
+    assert(gmbdll_pool_used(&pool) == 3);
+    k = 2;
+    assert(gmbdll_lru_get(&lru, &k) == NULL);
+
+    /* Test replace keeps the node and reports the old data */
+    void *old = NULL;
+    assert(gmbdll_lru_put(&lru, &e[4], &old) == gmbdll_OK);
+    assert(old == &e[0]);
+    k = 1;
+    assert(gmbdll_lru_get(&lru, &k) == &e[4]);
+    assert(gmbdll_lru_size(&lru) == 3);
+
+    /* Test remove and clear */
+    k = 3;
+    assert(gmbdll_lru_remove(&lru, &k) == &e[2]);
+    assert(gmbdll_lru_size(&lru) == 2);
+    gmbdll_lru_clear(&lru);
+    assert(gmbdll_lru_size(&lru) == 0);
+    assert(gmbdll_pool_used(&pool) == 0);
+    assert(gmbdll_lru_evictions(&lru) == 3);
+
+    printf("=== gmblru test passed ===\n");
+    return 0;
+}
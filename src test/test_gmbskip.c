@@ -0,0 +1,170 @@
+/* ==========================================
+ * test_gmbskip.c
+ * Unit test for the skip list ordered set
+ * Shuffled inserts, order, duplicates,
+ * lower_bound/range, erase, pool reuse
+ * ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include "gmbskip.h"
+
+#define N 20000
+
+/* Keys are even numbers stored directly in the data pointer */
+#define KEY(i) ((uintptr_t)(i) * 2 + 2)
+#define VAL(k) ((void *)(uintptr_t)(k))
+
+static int cmp_key(const void *item, const void *key) {
+    uintptr_t a = (uintptr_t)item, b = (uintptr_t)key;
+    return (a > b) - (a < b);
+}
+
+/* Records with the key inside, ordered through key_of */
+typedef struct {
+    int id;
+    const char *name;
+} Rec;
+
+static const void *rec_key(const void *data) {
+    return &((const Rec *)data)->id;
+}
+
+static int cmp_rec(const void *item, const void *key) {
+    int a = ((const Rec *)item)->id, b = *(const int *)key;
+    return (a > b) - (a < b);
+}
+
+static int sum_range(void *data, void *ctx) {
+    *(uintptr_t *)ctx += (uintptr_t)data;
+    return 0;
+}
+
+static int stop_after_3(void *data, void *ctx) {
+    (void)data;
+    return ++*(int *)ctx == 3;
+}
+
+static void *buffer[N * 8];  /* pointer-aligned tower memory */
+
+int main(void) {
+    printf("=== gmbskip test start ===\n");
+
+    gmbdll_SkipPool pool;
+    gmbdll_SkipList sl;
+    assert(gmbdll_skippool_init(&pool, buffer, sizeof(buffer)) == gmbdll_OK);
+    assert(gmbdll_skip_init(&sl, &pool, NULL, cmp_key, 42) == gmbdll_OK);
+    assert(gmbdll_skip_first(&sl) == NULL);
+    assert(gmbdll_skip_lower_bound(&sl, VAL(1)) == NULL);
+
+    /* Insert 0..N-1 in a shuffled order (odd stride modulo N) */
+    for (size_t i = 0; i < N; ++i) {
+        size_t j = (i * 7919) % N;
+        assert(gmbdll_skip_insert(&sl, VAL(KEY(j)), NULL) == gmbdll_OK);
+    }
+    assert(gmbdll_skip_size(&sl) == N);
+    assert(gmbdll_skippool_used(&pool) == N);
+
+    /* Ascending order on the bottom level */
+    size_t count = 0;
+    for (gmbdll_SkipNode *n = gmbdll_skip_first(&sl); n; n = gmbdll_skip_next(n)) {
+        assert((uintptr_t)n->data == KEY(count));
+        count++;
+    }
+    assert(count == N);
+
+    /* Duplicates are rejected and report the stored element */
+    void *existing = NULL;
+    assert(gmbdll_skip_insert(&sl, VAL(KEY(123)), &existing) == gmbdll_ERR);
+    assert(existing == VAL(KEY(123)));
+    assert(gmbdll_skip_size(&sl) == N);
+
+    /* find and lower_bound (odd keys fall between elements) */
+    assert(gmbdll_skip_find(&sl, VAL(KEY(500)))->data == VAL(KEY(500)));
+    assert(gmbdll_skip_find(&sl, VAL(KEY(500) + 1)) == NULL);
+    assert(gmbdll_skip_lower_bound(&sl, VAL(KEY(500) + 1))->data == VAL(KEY(501)));
+    assert(gmbdll_skip_lower_bound(&sl, VAL(0))->data == VAL(KEY(0)));
+    assert(gmbdll_skip_lower_bound(&sl, VAL(KEY(N - 1) + 1)) == NULL);
+
+    /* Range [KEY(10), KEY(20)) visits 10 elements */
+    uintptr_t sum = 0;
+    assert(gmbdll_skip_range(&sl, VAL(KEY(10)), VAL(KEY(20)), sum_range, &sum) == 10);
+    uintptr_t expect = 0;
+    for (size_t i = 10; i < 20; ++i) expect += KEY(i);
+    assert(sum == expect);
+    int calls = 0;
+    assert(gmbdll_skip_range(&sl, NULL, NULL, stop_after_3, &calls) == 3);
+
+    /* Erase every odd index */
+    for (size_t i = 1; i < N; i += 2) {
+        void *out = NULL;
+        assert(gmbdll_skip_erase(&sl, VAL(KEY(i)), &out) == gmbdll_OK);
+        assert(out == VAL(KEY(i)));
+    }
+    assert(gmbdll_skip_erase(&sl, VAL(KEY(1)), NULL) == gmbdll_ERR);
+    assert(gmbdll_skip_size(&sl) == N / 2);
+    assert(gmbdll_skippool_used(&pool) == N / 2);
+    assert(gmbdll_skip_lower_bound(&sl, VAL(KEY(1)))->data == VAL(KEY(2)));
+    count = 0;
+    for (gmbdll_SkipNode *n = gmbdll_skip_first(&sl); n; n = gmbdll_skip_next(n)) {
+        assert((uintptr_t)n->data == KEY(count * 2));
+        count++;
+    }
+    assert(count == N / 2);
+
+    /* Refilling reuses the released towers: only height mismatches take
+       fresh memory */
+    size_t bump = pool.bump;
+    for (size_t i = 1; i < N; i += 2) {
+        assert(gmbdll_skip_insert(&sl, VAL(KEY(i)), NULL) == gmbdll_OK);
+    }
+    assert(gmbdll_skip_size(&sl) == N);
+    assert(pool.bump <= bump + 64 * sizeof(void *) * GMB_DLLIST_SKIP_MAX_LEVEL);
+
+    gmbdll_skip_clear(&sl, NULL);
+    assert(gmbdll_skip_size(&sl) == 0);
+    assert(gmbdll_skippool_used(&pool) == 0);
+    assert(gmbdll_skip_first(&sl) == NULL);
+
+    /* Struct elements through key_of, two lists sharing the pool */
+    Rec recs[] = {{30, "c"}, {10, "a"}, {20, "b"}};
+    gmbdll_SkipList by_id;
+    assert(gmbdll_skip_init(&by_id, &pool, rec_key, cmp_rec, 0) == gmbdll_OK);
+    assert(gmbdll_skip_init(&sl, &pool, NULL, cmp_key, 7) == gmbdll_OK);
+    for (int i = 0; i < 3; ++i) {
+        assert(gmbdll_skip_insert(&by_id, &recs[i], NULL) == gmbdll_OK);
+        assert(gmbdll_skip_insert(&sl, VAL(KEY(i)), NULL) == gmbdll_OK);
+    }
+    assert(gmbdll_skippool_used(&pool) == 6);
+    int k = 15;
+    assert(((Rec *)gmbdll_skip_lower_bound(&by_id, &k)->data)->id == 20);
+    k = 10;
+    assert(gmbdll_skip_erase(&by_id, &k, NULL) == gmbdll_OK);
+    assert(((Rec *)gmbdll_skip_first(&by_id)->data)->id == 20);
+    gmbdll_skip_clear(&by_id, NULL);
+    gmbdll_skip_clear(&sl, NULL);
+
+    /* Exhaustion: a small pool fills up, the failed insert changes nothing */
+    static void *small[64];
+    assert(gmbdll_skippool_init(&pool, small, sizeof(small)) == gmbdll_OK);
+    assert(gmbdll_skip_init(&sl, &pool, NULL, cmp_key, 1) == gmbdll_OK);
+    size_t inserted = 0;
+    while (gmbdll_skip_insert(&sl, VAL(KEY(inserted)), &existing) == gmbdll_OK) inserted++;
+    assert(existing == NULL);
+    assert(inserted > 0 && gmbdll_skip_size(&sl) == inserted);
+    assert(gmbdll_skip_find(&sl, VAL(KEY(inserted))) == NULL);
+    assert(gmbdll_skip_erase(&sl, VAL(KEY(0)), NULL) == gmbdll_OK);
+    assert(gmbdll_skip_insert(&sl, VAL(KEY(0)), NULL) == gmbdll_OK);
+
+    /* Invalid arguments */
+    assert(gmbdll_skippool_init(NULL, small, sizeof(small)) == gmbdll_ERR);
+    assert(gmbdll_skippool_init(&pool, (char *)small + 1, 8) == gmbdll_ERR);
+    assert(gmbdll_skip_init(&sl, &pool, NULL, NULL, 0) == gmbdll_ERR);
+    assert(gmbdll_skip_insert(NULL, VAL(1), NULL) == gmbdll_ERR);
+    assert(gmbdll_skip_size(NULL) == 0);
+
+    printf("=== gmbskip test passed ===\n");
+    return 0;
+}
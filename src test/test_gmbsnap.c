@@ -0,0 +1,141 @@
+/* ==========================================
+ * test_gmbsnap.c
+ * Unit test for pool/list snapshots
+ * Save, reopen through mmap, keep using the
+ * restored lists, reject stale/corrupt files
+ * ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "gmbsnap.h"
+
+#define NODES 1000
+#define SNAP_PATH "test_gmbsnap.bin"
+
+/* Payloads are small integers stored directly in the data pointer */
+#define VAL(i) ((void *)(uintptr_t)((i) + 1))
+
+static gmbdll_Node buffer[NODES];
+
+#if GMB_DLLIST_INDEX_LINKS
+/* Flip one byte of the file at offset */
+static void corrupt(long offset) {
+    FILE *f = fopen(SNAP_PATH, "r+b");
+    assert(f);
+    fseek(f, offset, SEEK_SET);
+    int c = fgetc(f);
+    fseek(f, offset, SEEK_SET);
+    fputc(c ^ 0xFF, f);
+    fclose(f);
+}
+#endif
+
+int main(void) {
+    printf("=== gmbsnap test start ===\n");
+
+    gmbdll_Pool pool;
+    gmbdll_List a, b;
+    const gmbdll_List *lists[2] = {&a, &b};
+    gmbdll_Snapshot snap;
+
+    assert(gmbdll_pool_init_buffer(&pool, buffer, NODES) == gmbdll_OK);
+    gmbdll_list_init(&a, &pool);
+    gmbdll_list_init(&b, &pool);
+    for (int i = 0; i < 300; ++i) assert(gmbdll_push_back(&a, VAL(i)) == gmbdll_OK);
+    for (int i = 0; i < 50; ++i) assert(gmbdll_push_front(&b, VAL(1000 + i)) == gmbdll_OK);
+    for (int i = 0; i < 100; ++i) gmbdll_pop_front(&a); /* leaves a free list */
+
+#if GMB_DLLIST_INDEX_LINKS == 0
+    /* pointer links would need fixups: refused */
+    assert(gmbdll_snapshot_save(SNAP_PATH, &pool, lists, 2) == gmbdll_ERR);
+    assert(gmbdll_snapshot_open(&snap, SNAP_PATH, 0) == gmbdll_ERR);
+#else
+    /* Test save and restore */
+#if GMB_DLLIST_HANDLES
+    gmbdll_Handle saved = gmbdll_node_handle(&a, gmbdll_list_tail(&a));
+#endif
+    assert(gmbdll_snapshot_save(SNAP_PATH, &pool, lists, 2) == gmbdll_OK);
+    assert(gmbdll_snapshot_open(&snap, SNAP_PATH, GMB_DLLIST_SNAP_VERIFY) == gmbdll_OK);
+    assert(gmbdll_snapshot_list_count(&snap) == 2);
+
+    gmbdll_Pool rpool;
+    gmbdll_List r[2];
+    assert(gmbdll_snapshot_restore(&snap, &rpool, r, 1) == gmbdll_ERR); /* count mismatch */
+    assert(gmbdll_snapshot_restore(&snap, &rpool, r, 2) == gmbdll_OK);
+    assert(gmbdll_pool_capacity(&rpool) == NODES);
+    assert(gmbdll_pool_used(&rpool) == 250);
+    assert(gmbdll_list_size(&r[0]) == 200 && gmbdll_list_size(&r[1]) == 50);
+    int i = 100;
+    for (gmbdll_Node *n = gmbdll_list_head(&r[0]); n; n = gmbdll_node_next(&r[0], n)) {
+        assert(n->data == VAL(i++));
+    }
+    assert(i == 300);
+    assert(gmbdll_pop_back(&r[1]) == VAL(1000));
+#if GMB_DLLIST_HANDLES
+    /* restored lists get fresh tags, so saved handles must be taken again */
+    gmbdll_List fresh_list;
+    gmbdll_list_init(&fresh_list, &rpool);
+    assert(gmbdll_handle_node(&r[0], saved) == NULL);
+    saved = gmbdll_node_handle(&r[0], gmbdll_list_tail(&r[0]));
+    assert(gmbdll_handle_node(&r[0], saved) == gmbdll_list_tail(&r[0]));
+    assert(gmbdll_handle_node(&r[1], saved) == NULL);
+    assert(gmbdll_handle_node(&fresh_list, saved) == NULL);
+#endif
+
+    /* the restored pool recycles saved free nodes, then bumps fresh ones */
+    for (int k = 0; k < NODES - 249; ++k) assert(gmbdll_push_back(&r[1], VAL(k)) == gmbdll_OK);
+    assert(gmbdll_push_back(&r[1], VAL(0)) == gmbdll_ERR);
+    assert(gmbdll_pool_used(&rpool) == NODES);
+    gmbdll_list_clear(&r[1], NULL);
+    gmbdll_list_clear(&r[0], NULL);
+    assert(gmbdll_pool_used(&rpool) == 0);
+    gmbdll_snapshot_close(&snap);
+
+    /* the mapping is private: the file still holds the saved lists */
+    assert(gmbdll_snapshot_open(&snap, SNAP_PATH, GMB_DLLIST_SNAP_VERIFY) == gmbdll_OK);
+    assert(gmbdll_snapshot_restore(&snap, &rpool, r, 2) == gmbdll_OK);
+    assert(gmbdll_list_size(&r[0]) == 200 && gmbdll_pop_front(&r[0]) == VAL(100));
+    gmbdll_snapshot_close(&snap);
+
+    /* Test stale and corrupt files are rejected */
+    corrupt(4); /* version */
+    assert(gmbdll_snapshot_open(&snap, SNAP_PATH, 0) == gmbdll_ERR);
+    corrupt(4);
+    assert(gmbdll_snapshot_open(&snap, SNAP_PATH, 0) == gmbdll_OK);
+    gmbdll_snapshot_close(&snap);
+    corrupt(sizeof(gmbdll_SnapHeader) + 8); /* list table: header checksum */
+    assert(gmbdll_snapshot_open(&snap, SNAP_PATH, 0) == gmbdll_ERR);
+    corrupt(sizeof(gmbdll_SnapHeader) + 8);
+    corrupt(4096 + 3); /* first node: only caught when verifying */
+    assert(gmbdll_snapshot_open(&snap, SNAP_PATH, 0) == gmbdll_OK);
+    gmbdll_snapshot_close(&snap);
+    assert(gmbdll_snapshot_open(&snap, SNAP_PATH, GMB_DLLIST_SNAP_VERIFY) == gmbdll_ERR);
+    assert(gmbdll_snapshot_open(&snap, "missing_gmbsnap.bin", 0) == gmbdll_ERR);
+
+    /* Test unsupported pools are refused */
+    gmbdll_Magazine mag;
+    gmbdll_magazine_init(&mag, &pool);
+    assert(gmbdll_snapshot_save(SNAP_PATH, &pool, lists, 2) == gmbdll_ERR);
+    gmbdll_magazine_destroy(&mag);
+    assert(gmbdll_list_set_quota(&b, 0, 100) == gmbdll_OK); /* quota */
+    assert(gmbdll_snapshot_save(SNAP_PATH, &pool, lists, 2) == gmbdll_ERR);
+    assert(gmbdll_list_set_quota(&b, 0, 0) == gmbdll_OK);
+    gmbdll_List reserving;
+    gmbdll_list_init(&reserving, &pool);
+    assert(gmbdll_list_set_quota(&reserving, 1, 0) == gmbdll_OK); /* pool->reserved */
+    assert(gmbdll_snapshot_save(SNAP_PATH, &pool, lists, 2) == gmbdll_ERR);
+    assert(gmbdll_list_set_quota(&reserving, 0, 0) == gmbdll_OK);
+    assert(gmbdll_snapshot_save(SNAP_PATH, &pool, lists, 2) == gmbdll_OK);
+    gmbdll_List foreign;
+    gmbdll_list_init(&foreign, &rpool);
+    const gmbdll_List *mixed[2] = {&a, &foreign};
+    assert(gmbdll_snapshot_save(SNAP_PATH, &pool, mixed, 2) == gmbdll_ERR);
+    remove(SNAP_PATH);
+#endif
+
+    printf("=== gmbsnap test passed ===\n");
+    return 0;
+}
@@ -0,0 +1,103 @@
+/* ==========================================
+ * test_gmbspsc.c
+ * Unit test for the SPSC ring buffer
+ * Single-thread API checks, then a
+ * producer/consumer FIFO run
+ * ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include "gmbspsc.h"
+
+#define ITEMS 1000000
+#define SLOTS 1024
+
+static void *slots[SLOTS];
+static gmbdll_Spsc queue;
+
+/* Items are 1..ITEMS, pushed singly and in batches of varying size */
+static void *producer(void *arg) {
+    (void)arg;
+    void *batch[37];
+    uintptr_t next = 1;
+    while (next <= ITEMS) {
+        if (next % 3 == 0) {
+            size_t n = 0;
+            while (n < 37 && next + n <= ITEMS) {
+                batch[n] = (void *)(next + n);
+                n++;
+            }
+            size_t pushed = gmbdll_spsc_push_back_n(&queue, batch, n);
+            next += pushed;
+            if (pushed == 0) sched_yield();
+        } else if (gmbdll_spsc_push_back(&queue, (void *)next) == gmbdll_OK) {
+            next++;
+        } else {
+            sched_yield(); /* full */
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    printf("=== gmbspsc test start ===\n");
+
+    /* Test init */
+    void *small[4];
+    assert(gmbdll_spsc_init(&queue, small, 6) == gmbdll_ERR); /* not power of two */
+    assert(gmbdll_spsc_init(&queue, small, 4) == gmbdll_OK);
+    assert(gmbdll_spsc_capacity(&queue) == 4);
+    assert(gmbdll_spsc_is_empty(&queue) == 1);
+
+    /* Test FIFO order and capacity */
+    int vals[6] = {1, 2, 3, 4, 5, 6};
+    assert(gmbdll_spsc_pop_front(&queue) == NULL);
+    for (int i = 0; i < 4; ++i) assert(gmbdll_spsc_push_back(&queue, &vals[i]) == gmbdll_OK);
+    assert(gmbdll_spsc_push_back(&queue, &vals[4]) == gmbdll_ERR); /* full */
+    assert(gmbdll_spsc_size(&queue) == 4);
+    assert(gmbdll_spsc_pop_front(&queue) == &vals[0]);
+    assert(gmbdll_spsc_push_back(&queue, &vals[4]) == gmbdll_OK); /* wraps */
+    for (int i = 1; i < 5; ++i) assert(gmbdll_spsc_pop_front(&queue) == &vals[i]);
+    assert(gmbdll_spsc_is_empty(&queue) == 1);
+
+    /* Test batch push / pop */
+    void *items[6] = {&vals[0], &vals[1], &vals[2], &vals[3], &vals[4], &vals[5]};
+    void *out[6] = {0};
+    assert(gmbdll_spsc_push_back_n(&queue, items, 6) == 4); /* only room for 4 */
+    assert(gmbdll_spsc_pop_front_n(&queue, out, 3) == 3);
+    assert(out[0] == &vals[0] && out[2] == &vals[2]);
+    assert(gmbdll_spsc_push_back_n(&queue, items + 4, 2) == 2);
+    assert(gmbdll_spsc_pop_front_n(&queue, out, 6) == 3);
+    assert(out[0] == &vals[3] && out[1] == &vals[4] && out[2] == &vals[5]);
+    assert(gmbdll_spsc_pop_front_n(&queue, out, 6) == 0);
+
+    /* Test producer and consumer threads */
+    assert(gmbdll_spsc_init(&queue, slots, SLOTS) == gmbdll_OK);
+    pthread_t prod;
+    pthread_create(&prod, NULL, producer, NULL);
+    uintptr_t expect = 1;
+    while (expect <= ITEMS) {
+        if (expect % 5 == 0) {
+            void *got[16];
+            size_t n = gmbdll_spsc_pop_front_n(&queue, got, 16);
+            for (size_t i = 0; i < n; ++i) assert((uintptr_t)got[i] == expect++);
+            if (n == 0) sched_yield();
+        } else {
+            void *item = gmbdll_spsc_pop_front(&queue);
+            if (item) {
+                assert((uintptr_t)item == expect++);
+            } else {
+                sched_yield(); /* empty */
+            }
+        }
+    }
+    pthread_join(prod, NULL);
+    assert(gmbdll_spsc_is_empty(&queue) == 1);
+
+    printf("=== gmbspsc test passed ===\n");
+    return 0;
+}
@@ -0,0 +1,136 @@
+/* ==========================================
+ * test_gmbtwheel.c
+ * Unit test for the hierarchical timing wheel
+ * Timers on every level fire on their tick,
+ * cancel, reschedule from the callback
+ * ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include "gmbtwheel.h"
+
+#define TIMERS 2000
+#define NODES 4096
+
+static gmbdll_Node nodes[NODES];
+static gmbdll_Pool pool;
+static gmbdll_TimerWheel wheel;
+static gmbdll_Timer timers[TIMERS];
+static uint64_t fired_at[TIMERS];
+
+static void on_expire(gmbdll_Timer *t, void *ctx) {
+    size_t *fired = ctx;
+    size_t id = (size_t)(uintptr_t)t->data;
+    assert(wheel.now == t->expires);
+    assert(fired_at[id] == 0);
+    fired_at[id] = wheel.now;
+    (*fired)++;
+}
+
+/* Periodic timer: re-arms itself every 100 ticks, 5 times */
+static void on_periodic(gmbdll_Timer *t, void *ctx) {
+    int *runs = ctx;
+    assert(wheel.now == t->expires);
+    if (++*runs < 5) assert(gmbdll_twheel_schedule(&wheel, t, wheel.now + 100) == gmbdll_OK);
+}
+
+static uint32_t rng = 12345;
+static uint32_t next_rand(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+int main(void) {
+    printf("=== gmbtwheel test start ===\n");
+
+    assert(gmbdll_pool_init_buffer(&pool, nodes, NODES) == gmbdll_OK);
+    assert(gmbdll_twheel_init(&wheel, &pool, 1000) == gmbdll_OK);
+
+    /* Delays spread from 1 tick to past the 2^24 horizon; every third
+       timer is cancelled */
+    uint64_t expires[TIMERS];
+    for (size_t i = 0; i < TIMERS; ++i) {
+        uint64_t delay = 1 + next_rand() % ((uint64_t)1 << (2 + i % 25));
+        expires[i] = 1000 + delay;
+        gmbdll_timer_init(&timers[i], (void *)(uintptr_t)i);
+        assert(!gmbdll_timer_pending(&timers[i]));
+        assert(gmbdll_twheel_schedule(&wheel, &timers[i], expires[i]) == gmbdll_OK);
+        assert(gmbdll_timer_pending(&timers[i]));
+    }
+    assert(gmbdll_twheel_count(&wheel) == TIMERS);
+    assert(gmbdll_pool_used(&pool) == TIMERS);
+    for (size_t i = 0; i < TIMERS; i += 3) {
+        assert(gmbdll_twheel_cancel(&wheel, &timers[i]) == gmbdll_OK);
+        assert(gmbdll_twheel_cancel(&wheel, &timers[i]) == gmbdll_ERR);
+    }
+    /* Moving a pending timer keeps one node per timer */
+    assert(gmbdll_twheel_schedule(&wheel, &timers[1], 1500) == gmbdll_OK);
+    expires[1] = 1500;
+    size_t pending = TIMERS - (TIMERS + 2) / 3;
+    assert(gmbdll_twheel_count(&wheel) == pending);
+    assert(gmbdll_pool_used(&pool) == pending);
+
+    /* Advance in uneven steps until everything fired */
+    size_t fired = 0;
+    uint64_t now = 1000;
+    while (gmbdll_twheel_count(&wheel) > 0) {
+        now += 1 + next_rand() % 5000;
+        size_t before = fired;
+        assert(gmbdll_twheel_advance(&wheel, now, on_expire, &fired) == fired - before);
+        assert(wheel.now == now);
+    }
+    assert(fired == pending);
+    assert(gmbdll_pool_used(&pool) == 0);
+    for (size_t i = 0; i < TIMERS; ++i) {
+        if (i % 3 == 0) {
+            assert(fired_at[i] == 0);
+        } else {
+            assert(fired_at[i] == expires[i]);
+            assert(!gmbdll_timer_pending(&timers[i]));
+        }
+    }
+
+    /* Past ticks fire on the next tick; periodic re-arm from the callback */
+    gmbdll_Timer late, periodic;
+    gmbdll_timer_init(&late, (void *)(uintptr_t)0);
+    fired_at[0] = 0;
+    assert(gmbdll_twheel_schedule(&wheel, &late, 5) == gmbdll_OK);
+    assert(late.expires == now + 1);
+    assert(gmbdll_twheel_advance(&wheel, now + 1, on_expire, &fired) == 1);
+    assert(fired_at[0] == now + 1);
+    now++;
+
+    int runs = 0;
+    gmbdll_timer_init(&periodic, NULL);
+    assert(gmbdll_twheel_schedule(&wheel, &periodic, now + 100) == gmbdll_OK);
+    assert(gmbdll_twheel_advance(&wheel, now + 1000, on_periodic, &runs) == 5);
+    assert(runs == 5 && !gmbdll_timer_pending(&periodic));
+    now += 1000;
+
+    /* Pool exhaustion, then clear */
+    static gmbdll_Node few[4];
+    gmbdll_Pool small;
+    gmbdll_TimerWheel w2;
+    gmbdll_Timer t[5];
+    assert(gmbdll_pool_init_buffer(&small, few, 4) == gmbdll_OK);
+    assert(gmbdll_twheel_init(&w2, &small, 0) == gmbdll_OK);
+    for (int i = 0; i < 5; ++i) gmbdll_timer_init(&t[i], NULL);
+    for (int i = 0; i < 4; ++i) assert(gmbdll_twheel_schedule(&w2, &t[i], 10 + i * 1000) == gmbdll_OK);
+    uint64_t before = t[4].expires;
+    assert(gmbdll_twheel_schedule(&w2, &t[4], 10) == gmbdll_ERR);
+    assert(!gmbdll_timer_pending(&t[4]) && t[4].expires == before);
+    gmbdll_twheel_clear(&w2);
+    assert(gmbdll_twheel_count(&w2) == 0 && gmbdll_pool_used(&small) == 0);
+    assert(!gmbdll_timer_pending(&t[0]));
+    assert(gmbdll_twheel_advance(&w2, 100000, NULL, NULL) == 0);
+
+    assert(gmbdll_twheel_init(NULL, &pool, 0) == gmbdll_ERR);
+    assert(gmbdll_twheel_cancel(&w2, &t[0]) == gmbdll_ERR);
+
+    printf("=== gmbtwheel test passed ===\n");
+    return 0;
+}
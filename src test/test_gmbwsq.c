@@ -0,0 +1,110 @@
+/* ==========================================
+ * test_gmbwsq.c
+ * Unit test for the work-stealing deque
+ * Single-thread API checks, then one owner
+ * racing several thieves
+ * ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include "gmbwsq.h"
+
+#define THIEVES 3
+#define ITEMS 200000
+#define SLOTS 256
+
+static gmbdll_WsSlot slots[SLOTS];
+static gmbdll_WsDeque deque;
+static atomic_uchar seen[ITEMS + 1];
+static atomic_size_t taken;
+static atomic_int done;
+
+/* Every item (1..ITEMS) must be taken exactly once */
+static void take(void *item) {
+    uintptr_t v = (uintptr_t)item;
+    assert(v >= 1 && v <= ITEMS);
+    assert(atomic_fetch_add(&seen[v], 1) == 0);
+    atomic_fetch_add(&taken, 1);
+}
+
+static void *thief(void *arg) {
+    (void)arg;
+    while (!atomic_load(&done)) {
+        void *item;
+        if (gmbdll_wsdeque_steal(&deque, &item) == gmbdll_OK) {
+            take(item);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    printf("=== gmbwsq test start ===\n");
+
+    /* Test init */
+    gmbdll_WsSlot small[4];
+    assert(gmbdll_wsdeque_init(&deque, small, 3) == gmbdll_ERR); /* not power of two */
+    assert(gmbdll_wsdeque_init(&deque, small, 4) == gmbdll_OK);
+    assert(gmbdll_wsdeque_size(&deque) == 0);
+
+    /* Test owner LIFO, thief FIFO, capacity */
+    int a = 1, b = 2, c = 3, d = 4;
+    void *out = NULL;
+    assert(gmbdll_wsdeque_pop(&deque, &out) == gmbdll_ERR);
+    assert(gmbdll_wsdeque_steal(&deque, &out) == gmbdll_ERR);
+    assert(gmbdll_wsdeque_push(&deque, &a) == gmbdll_OK);
+    assert(gmbdll_wsdeque_push(&deque, &b) == gmbdll_OK);
+    assert(gmbdll_wsdeque_push(&deque, &c) == gmbdll_OK);
+    assert(gmbdll_wsdeque_push(&deque, &d) == gmbdll_OK);
+    assert(gmbdll_wsdeque_push(&deque, &d) == gmbdll_ERR); /* full */
+    assert(gmbdll_wsdeque_size(&deque) == 4);
+    assert(gmbdll_wsdeque_pop(&deque, &out) == gmbdll_OK && out == &d);
+    assert(gmbdll_wsdeque_steal(&deque, &out) == gmbdll_OK && out == &a);
+    assert(gmbdll_wsdeque_pop(&deque, &out) == gmbdll_OK && out == &c);
+    assert(gmbdll_wsdeque_steal(&deque, &out) == gmbdll_OK && out == &b);
+    assert(gmbdll_wsdeque_pop(&deque, &out) == gmbdll_ERR);
+    assert(gmbdll_wsdeque_size(&deque) == 0);
+
+    /* wrap around the buffer several times */
+    for (int i = 0; i < 10; ++i) {
+        assert(gmbdll_wsdeque_push(&deque, &a) == gmbdll_OK);
+        assert(gmbdll_wsdeque_push(&deque, &b) == gmbdll_OK);
+        assert(gmbdll_wsdeque_steal(&deque, &out) == gmbdll_OK && out == &a);
+        assert(gmbdll_wsdeque_pop(&deque, &out) == gmbdll_OK && out == &b);
+    }
+
+    /* Test one owner against concurrent thieves */
+    assert(gmbdll_wsdeque_init(&deque, slots, SLOTS) == gmbdll_OK);
+    pthread_t thieves[THIEVES];
+    for (int i = 0; i < THIEVES; ++i) pthread_create(&thieves[i], NULL, thief, NULL);
+
+    uintptr_t next = 1;
+    while (next <= ITEMS) {
+        /* push a burst, then pop part of it back */
+        for (int i = 0; i < 64 && next <= ITEMS; ++i) {
+            if (gmbdll_wsdeque_push(&deque, (void *)next) != gmbdll_OK) break;
+            next++;
+        }
+        for (int i = 0; i < 40; ++i) {
+            if (gmbdll_wsdeque_pop(&deque, &out) != gmbdll_OK) break;
+            take(out);
+        }
+    }
+    while (gmbdll_wsdeque_pop(&deque, &out) == gmbdll_OK) take(out);
+    while (atomic_load(&taken) < ITEMS) sched_yield();
+    atomic_store(&done, 1);
+    for (int i = 0; i < THIEVES; ++i) pthread_join(thieves[i], NULL);
+
+    assert(atomic_load(&taken) == ITEMS);
+    for (size_t i = 1; i <= ITEMS; ++i) assert(atomic_load(&seen[i]) == 1);
+    assert(gmbdll_wsdeque_size(&deque) == 0);
+
+    printf("=== gmbwsq test passed ===\n");
+    return 0;
+}
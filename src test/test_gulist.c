@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "gulist.h"
+
+// -------------------------------------------------
+// Simple test program for the unrolled list library
+// -------------------------------------------------
+int main(void) {
+    gulist list;
+    ulist_init(&list);
+
+    printf("=== Unrolled List Test ===\n");
+
+    // test: push_front
+    int a = 10, b = 20, c = 30;
+    ulist_push_front(&list, &a);
+    ulist_push_front(&list, &b);
+    ulist_push_front(&list, &c);
+    printf("After push_front (c, b, a):\n");
+    ulist_print_int(&list);
+
+    // test: push_back
+    int d = 40, e = 50;
+    ulist_push_back(&list, &d);
+    ulist_push_back(&list, &e);
+    printf("After push_back (d, e):\n");
+    ulist_print_int(&list);
+
+    // test: pop_front / pop_back
+    int *front_val = (int *)ulist_pop_front(&list);
+    assert(front_val == &c);
+    int *back_val = (int *)ulist_pop_back(&list);
+    assert(back_val == &e);
+    ulist_print_int(&list);
+
+    // test: order is kept across many block boundaries
+    static int values[1000];
+    ulist_destroy(&list);
+    for (int i = 0; i < 1000; ++i) {
+        values[i] = i;
+        if (i % 2) {
+            assert(ulist_push_back(&list, &values[i]) == 0);
+        } else {
+            assert(ulist_push_front(&list, &values[i]) == 0);
+        }
+    }
+    assert(list.size == 1000);
+    for (int i = 998; i >= 0; i -= 2) {
+        assert(*(int *)ulist_pop_front(&list) == i);
+    }
+    for (int i = 999; i >= 1; i -= 2) {
+        assert(*(int *)ulist_pop_back(&list) == i);
+    }
+    assert(list.size == 0);
+    assert(ulist_pop_front(&list) == NULL);
+    assert(ulist_pop_back(&list) == NULL);
+
+    // test: destroy
+    ulist_push_back(&list, &a);
+    ulist_destroy(&list);
+    printf("After destroy:\n");
+    ulist_print_int(&list);
+
+    return 0;
+}
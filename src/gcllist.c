@@ -0,0 +1,341 @@
+/*====================================================*/
+//
+//       	Thread-safe deque on gllist nodes:
+//		two-lock queue with blocking waits
+/*====================================================*/
+#define _POSIX_C_SOURCE 200809L  // pthread_condattr_setclock, clock_gettime
+
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+#include "gcllist.h"
+
+// --------------------------------------------------
+// Absolute CLOCK_MONOTONIC deadline timeout_ms from now
+// --------------------------------------------------
+static void deadline_after(struct timespec *ts, long timeout_ms) {
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    ts->tv_sec += timeout_ms / 1000;
+    ts->tv_nsec += (timeout_ms % 1000) * 1000000L;
+    if (ts->tv_nsec >= 1000000000L) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+// --------------------------------------------------
+// Wait on cond, until the deadline if one is given
+// Return 0 if woken, -1 on timeout (the caller must
+// still re-check its condition: it may have changed
+// between the timeout and re-acquiring the lock)
+// --------------------------------------------------
+static int cond_wait_until(pthread_cond_t *cond, pthread_mutex_t *lock,
+                           const struct timespec *deadline) {
+    if (deadline == NULL) {
+        pthread_cond_wait(cond, lock);
+        return 0;
+    }
+    return pthread_cond_timedwait(cond, lock, deadline) == ETIMEDOUT ? -1 : 0;
+}
+
+// --------------------------------------------------
+// Wait conditions (checked under tail_lock / head_lock)
+// --------------------------------------------------
+static int is_full(gcllist *list) {
+    return list->capacity != 0 && atomic_load(&list->size) >= list->capacity;
+}
+
+static int is_empty(gcllist *list) {
+    // acquire: pairs with the release in link_back
+    return atomic_load_explicit(&list->size, memory_order_acquire) == 0;
+}
+
+// --------------------------------------------------
+// Wake one consumer (called without head_lock held)
+// --------------------------------------------------
+static void signal_not_empty(gcllist *list) {
+    pthread_mutex_lock(&list->head_lock);
+    pthread_cond_signal(&list->not_empty);
+    pthread_mutex_unlock(&list->head_lock);
+}
+
+// --------------------------------------------------
+// Wake one producer (called without tail_lock held)
+// --------------------------------------------------
+static void signal_not_full(gcllist *list) {
+    pthread_mutex_lock(&list->tail_lock);
+    pthread_cond_signal(&list->not_full);
+    pthread_mutex_unlock(&list->tail_lock);
+}
+
+// --------------------------------------------------
+// Link node after the tail. Caller holds tail_lock
+// Return the size before the insertion
+// --------------------------------------------------
+static size_t link_back(gcllist *list, Node *node) {
+    node->next = NULL;
+    node->prev = list->tail;
+    list->tail->next = node;
+    list->tail = node;
+    // release: a consumer that sees the new size also sees the links
+    return atomic_fetch_add_explicit(&list->size, 1, memory_order_release);
+}
+
+// --------------------------------------------------
+// Unlink the first element. Caller holds head_lock and size > 0
+// The first node becomes the new dummy
+// Return the data; *old_size receives the size before removal
+// --------------------------------------------------
+static void *unlink_front(gcllist *list, size_t *old_size) {
+    Node *dummy = list->head;
+    Node *first = dummy->next;
+    void *data = first->data;
+
+    first->data = NULL;
+    first->prev = NULL;
+    list->head = first;
+    free(dummy);
+
+    *old_size = atomic_fetch_sub_explicit(&list->size, 1, memory_order_acq_rel);
+    return data;
+}
+
+// --------------------------------------------------
+// Initialize deque
+// Return 0 on success, -1 on failure
+// --------------------------------------------------
+int clist_init(gcllist *list, size_t capacity) {
+    pthread_condattr_t attr;
+
+    Node *dummy = (Node *)malloc(sizeof(Node));
+    if (dummy == NULL) {
+        return -1;
+    }
+    dummy->data = NULL;
+    dummy->next = NULL;
+    dummy->prev = NULL;
+
+    list->head = dummy;
+    list->tail = dummy;
+    atomic_init(&list->size, 0);
+    list->capacity = capacity;
+
+    pthread_mutex_init(&list->head_lock, NULL);
+    pthread_mutex_init(&list->tail_lock, NULL);
+
+    // deadlines are measured on the monotonic clock
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&list->not_empty, &attr);
+    pthread_cond_init(&list->not_full, &attr);
+    pthread_condattr_destroy(&attr);
+
+    return 0;
+}
+
+// -------------------------------------------------
+// Destroy the deque (frees all nodes, but not user data)
+// No other thread may use the deque during or after this call
+// -------------------------------------------------
+void clist_destroy(gcllist *list) {
+    Node *current = list->head;
+
+    while (current != NULL) {
+        Node *next_node = current->next;
+        free(current);
+        current = next_node;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    atomic_store(&list->size, 0);
+
+    pthread_cond_destroy(&list->not_empty);
+    pthread_cond_destroy(&list->not_full);
+    pthread_mutex_destroy(&list->head_lock);
+    pthread_mutex_destroy(&list->tail_lock);
+}
+
+// -------------------------------------------------
+// Push at the tail, optionally waiting for room
+// -------------------------------------------------
+static int push_back_common(gcllist *list, void *data, int wait, long timeout_ms) {
+    struct timespec deadline;
+    const struct timespec *until = NULL;
+
+    Node *node = (Node *)malloc(sizeof(Node));
+    if (node == NULL) {
+        return -1; // allocation failed
+    }
+    node->data = data;
+
+    if (wait && timeout_ms >= 0) {
+        deadline_after(&deadline, timeout_ms);
+        until = &deadline;
+    }
+
+    pthread_mutex_lock(&list->tail_lock);
+    while (is_full(list)) {
+        if (!wait || (cond_wait_until(&list->not_full, &list->tail_lock, until) != 0
+                      && is_full(list))) {
+            pthread_mutex_unlock(&list->tail_lock);
+            free(node);
+            return -1; // full
+        }
+    }
+
+    size_t old_size = link_back(list, node);
+
+    // pass the wake-up on to the next waiting producer
+    if (list->capacity != 0 && old_size + 1 < list->capacity) {
+        pthread_cond_signal(&list->not_full);
+    }
+    pthread_mutex_unlock(&list->tail_lock);
+
+    if (old_size == 0) {
+        signal_not_empty(list);
+    }
+    return 0;
+}
+
+// -------------------------------------------------
+// Pop at the head, optionally waiting for an element
+// -------------------------------------------------
+static int pop_front_common(gcllist *list, void **data_out, int wait, long timeout_ms) {
+    struct timespec deadline;
+    const struct timespec *until = NULL;
+    size_t old_size;
+
+    if (wait && timeout_ms >= 0) {
+        deadline_after(&deadline, timeout_ms);
+        until = &deadline;
+    }
+
+    pthread_mutex_lock(&list->head_lock);
+    while (is_empty(list)) {
+        if (!wait || (cond_wait_until(&list->not_empty, &list->head_lock, until) != 0
+                      && is_empty(list))) {
+            pthread_mutex_unlock(&list->head_lock);
+            return -1; // empty
+        }
+    }
+
+    *data_out = unlink_front(list, &old_size);
+
+    // pass the wake-up on to the next waiting consumer
+    if (old_size > 1) {
+        pthread_cond_signal(&list->not_empty);
+    }
+    pthread_mutex_unlock(&list->head_lock);
+
+    if (old_size == list->capacity) {
+        signal_not_full(list);
+    }
+    return 0;
+}
+
+// -------------------------------------------------
+// Add element at the end (never waits)
+// -------------------------------------------------
+int clist_push_back(gcllist *list, void *data) {
+    return push_back_common(list, data, 0, 0);
+}
+
+// -------------------------------------------------
+// Add element at the end, waiting for room
+// -------------------------------------------------
+int clist_push_wait(gcllist *list, void *data, long timeout_ms) {
+    return push_back_common(list, data, 1, timeout_ms);
+}
+
+// -------------------------------------------------
+// Remove the first element (never waits)
+// -------------------------------------------------
+void *clist_pop_front(gcllist *list) {
+    void *data = NULL;
+    pop_front_common(list, &data, 0, 0);
+    return data;
+}
+
+// -------------------------------------------------
+// Remove the first element, waiting for one
+// -------------------------------------------------
+int clist_pop_wait(gcllist *list, void **data_out, long timeout_ms) {
+    return pop_front_common(list, data_out, 1, timeout_ms);
+}
+
+// -------------------------------------------------
+// Add element at the beginning (takes both locks)
+// -------------------------------------------------
+int clist_push_front(gcllist *list, void *data) {
+    Node *node = (Node *)malloc(sizeof(Node));
+    if (node == NULL) {
+        return -1; // allocation failed
+    }
+
+    pthread_mutex_lock(&list->head_lock);
+    pthread_mutex_lock(&list->tail_lock);
+
+    size_t size = atomic_load(&list->size);
+    if (list->capacity != 0 && size >= list->capacity) {
+        pthread_mutex_unlock(&list->tail_lock);
+        pthread_mutex_unlock(&list->head_lock);
+        free(node);
+        return -1; // full
+    }
+
+    Node *dummy = list->head;
+    node->data = data;
+    node->prev = dummy;
+    node->next = dummy->next;
+    if (dummy->next != NULL) {
+        dummy->next->prev = node;
+    } else {
+        list->tail = node;
+    }
+    dummy->next = node;
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_release);
+
+    if (size == 0) {
+        pthread_cond_signal(&list->not_empty);
+    }
+
+    pthread_mutex_unlock(&list->tail_lock);
+    pthread_mutex_unlock(&list->head_lock);
+    return 0;
+}
+
+// -------------------------------------------------
+// Remove the last element (takes both locks)
+// -------------------------------------------------
+void *clist_pop_back(gcllist *list) {
+    void *data = NULL;
+
+    pthread_mutex_lock(&list->head_lock);
+    pthread_mutex_lock(&list->tail_lock);
+
+    size_t size = atomic_load(&list->size);
+    if (size > 0) {
+        Node *last = list->tail;
+        data = last->data;
+        list->tail = last->prev;
+        list->tail->next = NULL;
+        free(last);
+        atomic_fetch_sub_explicit(&list->size, 1, memory_order_release);
+
+        if (size == list->capacity) {
+            pthread_cond_signal(&list->not_full);
+        }
+    }
+
+    pthread_mutex_unlock(&list->tail_lock);
+    pthread_mutex_unlock(&list->head_lock);
+    return data;
+}
+
+// -------------------------------------------------
+// Number of elements at the time of the call
+// -------------------------------------------------
+size_t clist_size(gcllist *list) {
+    return atomic_load(&list->size);
+}
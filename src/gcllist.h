@@ -0,0 +1,65 @@
+#ifndef gcllist_H
+#define gcllist_H
+
+#include <stddef.h>    // for size_t
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "gllist.h"    // Node
+
+// ------------------------------------
+// Concurrent deque structure (two-lock queue)
+// head is a dummy node: the first element is head->next.
+// Producers at the back only take tail_lock, consumers at the
+// front only take head_lock; operations at the opposite ends
+// (push_front, pop_back) take both, head_lock first.
+// ------------------------------------
+typedef struct {
+    Node *head;                 // dummy node
+    Node *tail;                 // last node (the dummy when empty)
+    atomic_size_t size;         // number of elements in the deque
+    size_t capacity;            // maximum size, 0 = unbounded
+    pthread_mutex_t head_lock;  // guards head (front operations)
+    pthread_mutex_t tail_lock;  // guards tail (back operations)
+    pthread_cond_t not_empty;   // waited on with head_lock
+    pthread_cond_t not_full;    // waited on with tail_lock
+} gcllist;
+
+// ------------------------------------
+// Public API
+// All functions are thread-safe except init/destroy.
+// Timeouts are in milliseconds, negative = wait forever.
+// ------------------------------------
+
+// Initialize an empty deque holding at most capacity elements
+// (0 = unbounded). Return 0 on success, -1 on failure
+int clist_init(gcllist *list, size_t capacity);
+
+// Destroy the deque (frees nodes, but not user data)
+void clist_destroy(gcllist *list);
+
+// Add element at the end. Return 0 on success, -1 if full or
+// allocation failed
+int clist_push_back(gcllist *list, void *data);
+
+// Add element at the beginning. Return 0 on success, -1 if full
+// or allocation failed
+int clist_push_front(gcllist *list, void *data);
+
+// Remove and return the first / last element, NULL if empty
+void *clist_pop_front(gcllist *list);
+
+void *clist_pop_back(gcllist *list);
+
+// Add element at the end, waiting while the deque is full.
+// Return 0 on success, -1 on timeout or allocation failure
+int clist_push_wait(gcllist *list, void *data, long timeout_ms);
+
+// Remove the first element into *data_out, waiting while the deque
+// is empty. Return 0 on success, -1 on timeout
+int clist_pop_wait(gcllist *list, void **data_out, long timeout_ms);
+
+// Number of elements at the time of the call
+size_t clist_size(gcllist *list);
+
+#endif // gcllist_H
@@ -8,6 +8,89 @@
 #include <string.h>
 #include "gllist.h"
 
+// --------------------------------------------------
+// Statistics hooks (expand to nothing unless GLLIST_STATS)
+// --------------------------------------------------
+#if GLLIST_STATS
+#define STAT(stmt)             do { stmt; } while (0)
+#define STAT_PEAK(peak, value) do { if ((value) > (peak)) (peak) = (value); } while (0)
+#else
+#define STAT(stmt)             ((void)0)
+#define STAT_PEAK(peak, value) ((void)0)
+#endif
+
+// --------------------------------------------------
+// Slab chunk: header followed by contiguous nodes
+// --------------------------------------------------
+struct gllist_chunk {
+    gllist_chunk *next;   // older chunk
+    Node nodes[];         // chunk_nodes entries
+};
+
+// --------------------------------------------------
+// Get a node from the list's source
+// Recycled nodes first, then the untouched part of the
+// newest chunk, then a fresh chunk
+// --------------------------------------------------
+static Node *slab_alloc(gllist_slab *slab) {
+    if (slab->free_list != NULL) {
+        Node *n = slab->free_list;
+        slab->free_list = n->next;
+        return n;
+    }
+
+    if (slab->bump == slab->bump_end) {
+        gllist_chunk *chunk = (gllist_chunk *)malloc(sizeof(gllist_chunk) +
+                                                     slab->chunk_nodes * sizeof(Node));
+        if (chunk == NULL) {
+            return NULL;
+        }
+        chunk->next = slab->chunks;
+        slab->chunks = chunk;
+        slab->bump = chunk->nodes;
+        slab->bump_end = chunk->nodes + slab->chunk_nodes;
+        STAT(slab->stats.chunks++);
+    }
+
+    return slab->bump++;
+}
+
+static Node *node_alloc(gllist *list) {
+    gllist_slab *slab = list->slab;
+    Node *n = (slab == NULL) ? (Node *)malloc(sizeof(Node)) : slab_alloc(slab);
+
+#if GLLIST_STATS
+    if (n == NULL) {
+        list->stats.insert_failures++;
+        return NULL;
+    }
+    list->stats.inserts++;
+    if (slab != NULL) {
+        slab->stats.in_use++;
+        STAT_PEAK(slab->stats.peak_in_use, slab->stats.in_use);
+    }
+#endif
+    return n;
+}
+
+// --------------------------------------------------
+// Give a node back to the list's source
+// --------------------------------------------------
+static void node_free(gllist *list, Node *node) {
+    gllist_slab *slab = list->slab;
+
+    STAT(list->stats.removes++);
+    STAT(if (slab != NULL) slab->stats.in_use--);
+
+    if (slab == NULL) {
+        free(node);
+        return;
+    }
+
+    node->next = slab->free_list;
+    slab->free_list = node;
+}
+
 // --------------------------------------------------
 // Initialize list
 // --------------------------------------------------
@@ -15,6 +98,53 @@ void list_init(gllist *list) {
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->slab = NULL;
+#if GLLIST_STATS
+    memset(&list->stats, 0, sizeof(list->stats));
+#endif
+}
+
+// --------------------------------------------------
+// Initialize list backed by a slab
+// --------------------------------------------------
+void list_init_slab(gllist *list, gllist_slab *slab) {
+    list_init(list);
+    list->slab = slab;
+}
+
+// --------------------------------------------------
+// Initialize slab (no chunk is allocated until needed)
+// Return 0 on success, -1 on failure
+// --------------------------------------------------
+int list_slab_init(gllist_slab *slab, size_t chunk_nodes) {
+    if (slab == NULL) {
+        return -1;
+    }
+
+    slab->free_list = NULL;
+    slab->bump = NULL;
+    slab->bump_end = NULL;
+    slab->chunks = NULL;
+    slab->chunk_nodes = chunk_nodes ? chunk_nodes : GLLIST_SLAB_CHUNK_NODES;
+#if GLLIST_STATS
+    memset(&slab->stats, 0, sizeof(slab->stats));
+#endif
+    return 0;
+}
+
+// --------------------------------------------------
+// Release all chunks of the slab
+// --------------------------------------------------
+void list_slab_destroy(gllist_slab *slab) {
+    gllist_chunk *chunk = slab->chunks;
+
+    while (chunk != NULL) {
+        gllist_chunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+
+    list_slab_init(slab, slab->chunk_nodes);
 }
 
 // -------------------------------------------------
@@ -23,7 +153,7 @@ void list_init(gllist *list) {
 // -------------------------------------------------
 int list_push_back(gllist *list, void *data) {
 
-	Node *new_node = (Node *)malloc(sizeof(Node));
+	Node *new_node = node_alloc(list);
 	if (!new_node) return -1; // allocation failed
 
     	new_node->data = data;
@@ -38,6 +168,7 @@ int list_push_back(gllist *list, void *data) {
 
     	list->tail = new_node;
     	list->size++;
+    	STAT_PEAK(list->stats.peak_size, list->size);
     	return 0;
 }
 
@@ -47,7 +178,7 @@ int list_push_back(gllist *list, void *data) {
 // -------------------------------------------------
 int list_push_front(gllist *list, void *data) {
     // allocate new node
-    Node *new_node = (Node *)malloc(sizeof(Node));
+    Node *new_node = node_alloc(list);
     if (new_node == NULL) {
         return -1; // allocation failed
     }
@@ -67,6 +198,7 @@ int list_push_front(gllist *list, void *data) {
     // update head and size
     list->head = new_node;
     list->size++;
+    STAT_PEAK(list->stats.peak_size, list->size);
 
     return 0; // success
 }
@@ -97,7 +229,7 @@ void *list_pop_front(gllist *list) {
     }
 
     // free the old node
-    free(old_head);
+    node_free(list, old_head);
 
     // update size
     list->size--;
@@ -132,7 +264,7 @@ void *list_pop_back(gllist *list) {
     }
 
     // free the old node
-    free(old_tail);
+    node_free(list, old_tail);
 
     // update size
     list->size--;
@@ -149,6 +281,18 @@ void list_destroy(gllist *list) {
     Node *current = list->head;
     Node *next_node;
 
+    STAT(list->stats.removes += list->size);
+    STAT(if (list->slab != NULL) list->slab->stats.in_use -= list->size);
+
+    if (list->slab != NULL) {
+        // the nodes are already chained: hand them back in one step
+        if (list->tail != NULL) {
+            list->tail->next = list->slab->free_list;
+            list->slab->free_list = list->head;
+        }
+        current = NULL;
+    }
+
     // iterate through the list and free all nodes
     while (current != NULL) {
         next_node = current->next;
@@ -162,6 +306,361 @@ void list_destroy(gllist *list) {
     list->size = 0;
 }
 
+// -------------------------------------------------
+// Push n elements at the tail in one call
+// The new nodes are chained privately, then attached once
+// Return the number of elements pushed
+// -------------------------------------------------
+size_t list_push_back_n(gllist *list, void *const *items, size_t n) {
+    Node *first = NULL;
+    Node *last = NULL;
+    size_t count = 0;
+
+    while (count < n) {
+        Node *new_node = node_alloc(list);
+        if (new_node == NULL) {
+            break; // allocation failed, keep what we have
+        }
+
+        new_node->data = items[count];
+        new_node->prev = last;
+        new_node->next = NULL;
+
+        if (last != NULL) {
+            last->next = new_node;
+        } else {
+            first = new_node;
+        }
+        last = new_node;
+        count++;
+    }
+
+    if (first == NULL) {
+        return 0;
+    }
+
+    // attach the chain after the current tail
+    first->prev = list->tail;
+    if (list->tail != NULL) {
+        list->tail->next = first;
+    } else {
+        list->head = first;
+    }
+    list->tail = last;
+    list->size += count;
+    STAT_PEAK(list->stats.peak_size, list->size);
+
+    return count;
+}
+
+// -------------------------------------------------
+// Pop up to n elements from the head in one call
+// Return the number of elements popped
+// -------------------------------------------------
+size_t list_pop_front_n(gllist *list, void **out, size_t n) {
+    Node *first = list->head;
+    Node *last = NULL;
+    Node *current = first;
+    size_t count = 0;
+
+    while (current != NULL && count < n) {
+        out[count++] = current->data;
+        last = current;
+        current = current->next;
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+
+    // detach [first, last] from the list
+    list->head = current;
+    if (current != NULL) {
+        current->prev = NULL;
+    } else {
+        list->tail = NULL;
+    }
+    list->size -= count;
+    STAT(list->stats.removes += count);
+    STAT(if (list->slab != NULL) list->slab->stats.in_use -= count);
+
+    if (list->slab != NULL) {
+        // give the whole chain back at once
+        last->next = list->slab->free_list;
+        list->slab->free_list = first;
+    } else {
+        while (first != current) {
+            Node *next_node = first->next;
+            free(first);
+            first = next_node;
+        }
+    }
+
+    return count;
+}
+
+// -------------------------------------------------
+// Move all elements of src before pos in dst
+// Return 0 on success, -1 on failure
+// -------------------------------------------------
+int list_splice(gllist *dst, Node *pos, gllist *src) {
+    if (dst == src || dst->slab != src->slab) {
+        return -1; // nodes must come from the same source
+    }
+
+    if (src->head == NULL) {
+        return 0; // nothing to move
+    }
+
+    Node *before = (pos != NULL) ? pos->prev : dst->tail;
+
+    src->head->prev = before;
+    if (before != NULL) {
+        before->next = src->head;
+    } else {
+        dst->head = src->head;
+    }
+
+    src->tail->next = pos;
+    if (pos != NULL) {
+        pos->prev = src->tail;
+    } else {
+        dst->tail = src->tail;
+    }
+
+    dst->size += src->size;
+    STAT_PEAK(dst->stats.peak_size, dst->size);
+
+    src->head = NULL;
+    src->tail = NULL;
+    src->size = 0;
+
+    return 0;
+}
+
+// -------------------------------------------------
+// Move all elements of src to the end of dst
+// Return 0 on success, -1 on failure
+// -------------------------------------------------
+int list_concat(gllist *dst, gllist *src) {
+    return list_splice(dst, NULL, src);
+}
+
+// -------------------------------------------------
+// Move node and all following elements into out
+// Return 0 on success, -1 on failure
+// -------------------------------------------------
+int list_split_at(gllist *list, Node *node, gllist *out) {
+    if (node == NULL || out == list) {
+        return -1;
+    }
+
+    // count the moved part (the only non-O(1) step)
+    size_t moved = 0;
+    for (const Node *current = node; current != NULL; current = current->next) {
+        moved++;
+    }
+
+    list_init_slab(out, list->slab);
+    out->head = node;
+    out->tail = list->tail;
+    out->size = moved;
+
+    list->tail = node->prev;
+    if (list->tail != NULL) {
+        list->tail->next = NULL;
+    } else {
+        list->head = NULL;
+    }
+    list->size -= moved;
+
+    node->prev = NULL;
+
+    return 0;
+}
+
+// -------------------------------------------------
+// Sort the list in place: bottom-up merge sort
+// Each pass merges runs of insize nodes through the next
+// pointers; prev pointers are rebuilt while merging
+// -------------------------------------------------
+void list_sort(gllist *list, int (*cmp)(const void *a, const void *b)) {
+    if (list->size < 2) {
+        return;
+    }
+#if GLLIST_STATS
+    uint64_t t0 = GLLIST_STATS_CLOCK();
+#endif
+
+    Node *head = list->head;
+    Node *tail;
+    size_t insize = 1;
+
+    for (;;) {
+        Node *p = head;
+        size_t nmerges = 0;
+        head = NULL;
+        tail = NULL;
+
+        while (p != NULL) {
+            Node *q = p;
+            size_t psize = 0;
+            size_t qsize = insize;
+            nmerges++;
+
+            // step q past the first run
+            while (q != NULL && psize < insize) {
+                psize++;
+                q = q->next;
+            }
+
+            // merge the two runs
+            while (psize > 0 || (qsize > 0 && q != NULL)) {
+                Node *e;
+                if (psize == 0) {
+                    e = q; q = q->next; qsize--;
+                } else if (qsize == 0 || q == NULL || cmp(p->data, q->data) <= 0) {
+                    e = p; p = p->next; psize--;
+                } else {
+                    e = q; q = q->next; qsize--;
+                }
+
+                if (tail != NULL) {
+                    tail->next = e;
+                } else {
+                    head = e;
+                }
+                e->prev = tail;
+                tail = e;
+            }
+            p = q;
+        }
+
+        tail->next = NULL;
+        if (nmerges <= 1) {
+            break;
+        }
+        insize *= 2;
+    }
+
+    list->head = head;
+    list->tail = tail;
+    STAT((list->stats.sorts++,
+          list->stats.sort_ticks += (uint64_t)GLLIST_STATS_CLOCK() - t0));
+}
+
+// -------------------------------------------------
+// Insert data in sorted position, after equal elements
+// Return the new node, or NULL on allocation failure
+// -------------------------------------------------
+Node *list_insert_sorted(gllist *list, void *data,
+                         int (*cmp)(const void *a, const void *b), Node *hint) {
+    Node *pos; // insert before pos, NULL = at the tail
+
+    if (list->tail == NULL || cmp(list->tail->data, data) <= 0) {
+        pos = NULL; // append: the common case for increasing keys
+    } else if (hint != NULL && cmp(hint->data, data) <= 0) {
+        // walk forward from the hint
+        pos = hint->next;
+        while (pos != NULL && cmp(pos->data, data) <= 0) {
+            pos = pos->next;
+        }
+    } else if (hint != NULL) {
+        // walk backward from the hint
+        pos = hint;
+        while (pos->prev != NULL && cmp(pos->prev->data, data) > 0) {
+            pos = pos->prev;
+        }
+    } else {
+        pos = list->head;
+        while (pos != NULL && cmp(pos->data, data) <= 0) {
+            pos = pos->next;
+        }
+    }
+
+    Node *new_node = node_alloc(list);
+    if (new_node == NULL) {
+        return NULL; // allocation failed
+    }
+
+    new_node->data = data;
+    new_node->next = pos;
+    new_node->prev = (pos != NULL) ? pos->prev : list->tail;
+
+    if (new_node->prev != NULL) {
+        new_node->prev->next = new_node;
+    } else {
+        list->head = new_node;
+    }
+
+    if (pos != NULL) {
+        pos->prev = new_node;
+    } else {
+        list->tail = new_node;
+    }
+
+    list->size++;
+    STAT_PEAK(list->stats.peak_size, list->size);
+    return new_node;
+}
+
+#if GLLIST_STATS
+// -------------------------------------------------
+// Zero the list counters, peak restarts from the size
+// -------------------------------------------------
+void list_stats_reset(gllist *list) {
+    memset(&list->stats, 0, sizeof(list->stats));
+    list->stats.peak_size = list->size;
+}
+
+// -------------------------------------------------
+// Zero the slab counters, peak restarts from the use
+// -------------------------------------------------
+void list_slab_stats_reset(gllist_slab *slab) {
+    size_t in_use = slab->stats.in_use;
+    memset(&slab->stats, 0, sizeof(slab->stats));
+    slab->stats.in_use = in_use;
+    slab->stats.peak_in_use = in_use;
+}
+
+// -------------------------------------------------
+// Dump list counters as one JSON line
+// Return 0 on success, -1 on failure
+// -------------------------------------------------
+int list_stats_json(const gllist *list, const char *name, FILE *out) {
+    if (list == NULL || out == NULL) {
+        return -1;
+    }
+
+    const gllist_stats *st = &list->stats;
+    fprintf(out, "{\"type\":\"gllist\",\"name\":\"%s\",\"size\":%zu,"
+            "\"peak_size\":%zu,\"inserts\":%llu,\"insert_failures\":%llu,"
+            "\"removes\":%llu,\"sorts\":%llu,\"sort_ticks\":%llu}\n",
+            name ? name : "", list->size, st->peak_size,
+            (unsigned long long)st->inserts, (unsigned long long)st->insert_failures,
+            (unsigned long long)st->removes, (unsigned long long)st->sorts,
+            (unsigned long long)st->sort_ticks);
+    return ferror(out) ? -1 : 0;
+}
+
+// -------------------------------------------------
+// Dump slab counters as one JSON line
+// Return 0 on success, -1 on failure
+// -------------------------------------------------
+int list_slab_stats_json(const gllist_slab *slab, const char *name, FILE *out) {
+    if (slab == NULL || out == NULL) {
+        return -1;
+    }
+
+    const gllist_slab_stats *st = &slab->stats;
+    fprintf(out, "{\"type\":\"gllist_slab\",\"name\":\"%s\",\"chunk_nodes\":%zu,"
+            "\"chunks\":%llu,\"in_use\":%zu,\"peak_in_use\":%zu}\n",
+            name ? name : "", slab->chunk_nodes, (unsigned long long)st->chunks,
+            st->in_use, st->peak_in_use);
+    return ferror(out) ? -1 : 0;
+}
+#endif
+
 // -------------------------------------------------
 // Debug function: print all integers in the list
 // Assumes that data pointers are of type (int *)
@@ -3,6 +3,41 @@
 
 #include <stddef.h> // for size_t
 
+// ------------------------------------
+// Statistics layer (0 = compiled out, no fields and no code)
+// With 1, lists and slabs keep counters and peaks, dumped as
+// JSON lines by list_stats_json() / list_slab_stats_json()
+// ------------------------------------
+#ifndef GLLIST_STATS
+#define GLLIST_STATS 0
+#endif
+
+// Timing hook: expression returning the current time as uint64_t
+// (any unit); list_sort accumulates it. Default 0: no timing
+#ifndef GLLIST_STATS_CLOCK
+#define GLLIST_STATS_CLOCK() 0
+#endif
+
+#if GLLIST_STATS
+#include <stdint.h>
+#include <stdio.h>
+
+typedef struct {
+    uint64_t inserts;         // elements added
+    uint64_t insert_failures; // node allocation failed
+    uint64_t removes;         // elements removed (pop, destroy)
+    size_t peak_size;         // high-water mark of size
+    uint64_t sorts;           // list_sort calls
+    uint64_t sort_ticks;      // GLLIST_STATS_CLOCK time spent sorting
+} gllist_stats;
+
+typedef struct {
+    uint64_t chunks;          // chunks allocated
+    size_t in_use;            // nodes held by lists
+    size_t peak_in_use;       // high-water mark of in_use
+} gllist_slab_stats;
+#endif
+
 // ------------------------------------
 // Node structure
 // ------------------------------------
@@ -12,6 +47,28 @@ typedef struct Node {
     struct Node *prev;    // pointer to the previous node
 } Node;
 
+// ------------------------------------
+// Slab allocator (optional node source)
+// ------------------------------------
+
+// Default number of nodes carved from each slab chunk
+#ifndef GLLIST_SLAB_CHUNK_NODES
+#define GLLIST_SLAB_CHUNK_NODES 256
+#endif
+
+typedef struct gllist_chunk gllist_chunk;
+
+typedef struct {
+    Node *free_list;      // recycled nodes, linked through next
+    Node *bump;           // next never-used node in the newest chunk
+    Node *bump_end;       // end of the newest chunk
+    gllist_chunk *chunks; // chain of chunks owned by the slab
+    size_t chunk_nodes;   // nodes per chunk
+#if GLLIST_STATS
+    gllist_slab_stats stats;
+#endif
+} gllist_slab;
+
 // ------------------------------------
 // Linked list structure
 // ------------------------------------
@@ -19,6 +76,10 @@ typedef struct {
     Node *head;           // pointer to the first node
     Node *tail;           // pointer to the last node
     size_t size;          // number of elements in the list
+    gllist_slab *slab;    // node source, NULL = malloc per node
+#if GLLIST_STATS
+    gllist_stats stats;
+#endif
 } gllist;
 
 // ------------------------------------
@@ -28,6 +89,18 @@ typedef struct {
 // Initialize an empty list
 void list_init(gllist *list);
 
+// Initialize an empty list that takes its nodes from a slab.
+// Several lists may share one slab; the slab must outlive them.
+void list_init_slab(gllist *list, gllist_slab *slab);
+
+// Initialize a slab carving chunk_nodes nodes per chunk
+// (0 = GLLIST_SLAB_CHUNK_NODES). Return 0 on success, -1 on failure
+int list_slab_init(gllist_slab *slab, size_t chunk_nodes);
+
+// Release every chunk of the slab at once. All lists using it
+// must be destroyed (or abandoned) before this call
+void list_slab_destroy(gllist_slab *slab);
+
 // Add element at the end of the list
 int list_push_back(gllist *list, void *data);
 
@@ -40,9 +113,55 @@ void *list_pop_front(gllist *list);
 // Remove and return the element at the end of the list
 void *list_pop_back(gllist *list);
 
-// Destroy the entire list (frees nodes, but not user data)
+// Destroy the entire list (frees nodes, but not user data).
+// Slab lists hand their whole node chain back to the slab in O(1)
 void list_destroy(gllist *list);
 
+// Add n elements at the end of the list, in array order.
+// Return the number of elements added (< n only on allocation failure)
+size_t list_push_back_n(gllist *list, void *const *items, size_t n);
+
+// Remove up to n elements from the beginning of the list into out[].
+// Return the number of elements removed
+size_t list_pop_front_n(gllist *list, void **out, size_t n);
+
+// Move all elements of src before pos in dst (pos NULL = at the end).
+// Both lists must use the same node source (same slab, or both malloc).
+// O(1). Return 0 on success, -1 on failure
+int list_splice(gllist *dst, Node *pos, gllist *src);
+
+// Move all elements of src to the end of dst. O(1). Return 0 or -1
+int list_concat(gllist *dst, gllist *src);
+
+// Move node and every element after it into out (overwritten, attached
+// to the same node source). Relinking is O(1); counting the moved
+// elements walks them. Return 0 on success, -1 on failure
+int list_split_at(gllist *list, Node *node, gllist *out);
+
+// Sort the list in place (stable bottom-up merge sort, no allocation).
+// cmp returns < 0 if a sorts before b, 0 if equal, > 0 otherwise
+void list_sort(gllist *list, int (*cmp)(const void *a, const void *b));
+
+// Insert data into a list sorted by cmp, after any equal elements.
+// hint (optional) is a node near the insertion point, e.g. the node
+// returned by the previous call; the search walks from there.
+// Return the new node, or NULL on allocation failure
+Node *list_insert_sorted(gllist *list, void *data,
+                         int (*cmp)(const void *a, const void *b), Node *hint);
+
+#if GLLIST_STATS
+// Zero the counters (peaks restart from the current size / use)
+void list_stats_reset(gllist *list);
+
+void list_slab_stats_reset(gllist_slab *slab);
+
+// Write the counters as one JSON object and a newline, tagged with
+// name. Return 0 on success, -1 on failure
+int list_stats_json(const gllist *list, const char *name, FILE *out);
+
+int list_slab_stats_json(const gllist_slab *slab, const char *name, FILE *out);
+#endif
+
 // Optional: debug function for printing list of integers
 void list_print_int(const gllist *list);
 
@@ -9,37 +9,192 @@
  * Date: September 2025
  *=============================================================== */
 
+#define _DEFAULT_SOURCE /* madvise (gmbdll_pool_trim) */
+
+ #include <string.h>
+ #include <stdatomic.h>
+#if defined(__unix__) || defined(__APPLE__)
+ #include <sys/mman.h>
+ #include <unistd.h>
+#endif
+
  #include "gmbdllist.h" // declare types and prototypes
 
+/* ---------------------------
+   Link helpers
+   Every link (node next/prev, free_list, list head/tail) goes through
+   these so the same code serves pointer and index representations.
+   --------------------------- */
+
+#define POOL_BASE(pool)     ((pool)->buf ? (pool)->buf : (pool)->nodes)
+
+#if GMB_DLLIST_INDEX_LINKS
+#define TO_PTR(pool, l)     ((l) == GMB_DLLIST_NIL ? NULL : &POOL_BASE(pool)[(l)])
+#define TO_LINK(pool, n)    ((n) ? (gmbdll_Link)((n) - POOL_BASE(pool)) : GMB_DLLIST_NIL)
+#else
+#define TO_PTR(pool, l)     ((void)(pool), (l))
+#define TO_LINK(pool, n)    ((void)(pool), (n))
+#endif
+
+/* Element of a node: inline nodes (data == NULL) hold it in the payload */
+#if GMB_DLLIST_PAYLOAD_SIZE > 0
+#define NODE_DATA(n)        ((n)->data ? (n)->data : (void *)(n)->payload.bytes)
+#else
+#define NODE_DATA(n)        ((n)->data)
+#endif
+
+/* Software prefetch (no-op on compilers without the builtin) */
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(p)         __builtin_prefetch(p)
+#else
+#define PREFETCH(p)         ((void)(p))
+#endif
+
+#define NEXT(pool, n)        TO_PTR(pool, (n)->next)
+#define PREV(pool, n)        TO_PTR(pool, (n)->prev)
+#define SET_NEXT(pool, n, m) ((n)->next = TO_LINK(pool, m))
+#define SET_PREV(pool, n, m) ((n)->prev = TO_LINK(pool, m))
+#define HEAD(list)           TO_PTR((list)->pool, (list)->head)
+#define TAIL(list)           TO_PTR((list)->pool, (list)->tail)
+#define SET_HEAD(list, n)    ((list)->head = TO_LINK((list)->pool, n))
+#define SET_TAIL(list, n)    ((list)->tail = TO_LINK((list)->pool, n))
+
+/* ---------------------------
+   Ownership hooks
+   (generation + owner tag, trivial unless GMB_DLLIST_HANDLES)
+   --------------------------- */
+
+#if GMB_DLLIST_HANDLES
+/* Last list tag handed out. Process-wide, so that a node (or handle) of
+   one pool never matches a list of another pool. */
+static atomic_uint list_tags;
+
+#define NODE_CLAIM(list, n)  ((n)->owner = (list)->tag)
+#define NODE_OWNED(list, n)  ((n)->owner == (list)->tag)
+/* generation 0 is skipped so that a zeroed handle never matches */
+#define NODE_RELEASE(n)      ((n)->owner = 0, (n)->gen = (n)->gen + 1 ? (n)->gen + 1 : 1)
+#else
+#define NODE_CLAIM(list, n)  ((void)0)
+#define NODE_OWNED(list, n)  1
+#define NODE_RELEASE(n)      ((void)0)
+#endif
+
+/* ---------------------------
+   Statistics hooks
+   (expand to nothing unless GMB_DLLIST_STATS)
+   --------------------------- */
+
+#if GMB_DLLIST_STATS
+#define STAT(stmt)              do { stmt; } while (0)
+#define STAT_PEAK(peak, value)  do { if ((value) > (peak)) (peak) = (value); } while (0)
+
+/* Account one lookup that probed probes entries and started at t0. */
+static void stat_lookup(uint64_t *count, uint64_t *total, uint64_t *ticks,
+                        uint64_t *hist, uint64_t probes, uint64_t t0) {
+    size_t bucket = 0;
+    while (bucket < GMB_DLLIST_STATS_BUCKETS - 1 && (probes >> bucket) != 0) bucket++;
+    (*count)++;
+    *total += probes;
+    *ticks += (uint64_t)GMB_DLLIST_STATS_CLOCK() - t0;
+    hist[bucket]++;
+}
+#else
+#define STAT(stmt)              ((void)0)
+#define STAT_PEAK(peak, value)  ((void)0)
+#endif
+
 /* ---------------------------
    Internal (static) functions
    --------------------------- */
 
-/* Initialize pool: link all nodes into the free_list. */
-static void pool_init(gmbdll_Pool *pool) {
+/* Initialize pool on buffer (NULL = built-in nodes[]).
+   Nothing is linked here: see pool_alloc_node. */
+static void pool_init(gmbdll_Pool *pool, gmbdll_Node *buffer, size_t count) {
     if (!pool) return;
-    pool->free_list = NULL;
-    pool->capacity = GMB_DLLIST_MAX_NODES;
+    pool->buf = buffer;
+    pool->free_list = GMB_DLLIST_NIL;
+    pool->fresh = 0;
+    pool->capacity = count;
     pool->used = 0;
-    /* Link all nodes into free list */
-    for (size_t i = 0; i < pool->capacity; ++i) {
-        gmbdll_Node *n = &pool->nodes[i];
-        n->data = NULL;
-        n->prev = NULL;
-        n->next = pool->free_list; /* push onto free_list */
-        pool->free_list = n;
-    }
-}
-
-/* Allocate one node from pool. Returns NULL if pool exhausted. */
-static gmbdll_Node *pool_alloc_node(gmbdll_Pool *pool) {
-    if (!pool || pool->free_list == NULL) return NULL;
-    gmbdll_Node *n = pool->free_list;
-    pool->free_list = n->next; /* next free */
-    n->next = NULL;
-    n->prev = NULL;
+    pool->blocks = NULL;
+    pool->grow_nodes = 0;
+    pool->grow_alloc = NULL;
+    pool->grow_free = NULL;
+    pool->grow_ctx = NULL;
+    pool->mags = NULL;
+    pool->reserved = 0;
+#if GMB_DLLIST_HANDLES
+    pool->gen_floor = 1;
+#endif
+#if GMB_DLLIST_STATS
+    memset(&pool->stats, 0, sizeof(pool->stats));
+#endif
+}
+
+/* Free nodes not promised to a list reservation. Saturates at 0 rather
+   than trusting used + reserved <= capacity. */
+static size_t pool_unreserved(const gmbdll_Pool *pool) {
+    if (pool->used + pool->reserved >= pool->capacity) return 0;
+    return pool->capacity - pool->used - pool->reserved;
+}
+
+/* Chain one more block to the pool; it becomes the bump segment.
+   Returns 0 on success. */
+static int pool_grow(gmbdll_Pool *pool) {
+    if (pool->grow_nodes == 0) return gmbdll_ERR;
+    gmbdll_Block *block = (gmbdll_Block *)pool->grow_alloc(
+        sizeof(gmbdll_Block) + pool->grow_nodes * sizeof(gmbdll_Node), pool->grow_ctx);
+    if (!block) return gmbdll_ERR;
+    block->count = pool->grow_nodes;
+    block->next = pool->blocks;
+    pool->blocks = block;
+    pool->capacity += block->count;
+    pool->fresh = 0;
+    STAT(pool->stats.grows++);
+    return gmbdll_OK;
+}
+
+/* Allocate one node from pool. Returns NULL if pool exhausted.
+   Recycled nodes come first, then never-used nodes of the newest
+   segment (the newest block, or the base array if none), then a
+   new block if the growth policy allows it. Unless the node is taken
+   from a list reservation (reserved != 0), the pool->reserved nodes
+   promised to lists are left alone. */
+static gmbdll_Node *pool_alloc_node(gmbdll_Pool *pool, int reserved) {
+    if (!pool) return NULL;
+    gmbdll_Node *n;
+    if (!reserved && pool->reserved > 0 && pool_unreserved(pool) == 0) {
+        /* only reserved nodes are left: a new block helps only once
+           the current segment is used up */
+        size_t seg_count = pool->blocks ? pool->blocks->count : pool->capacity;
+        if (pool->free_list != GMB_DLLIST_NIL || pool->fresh < seg_count ||
+            pool_grow(pool) != gmbdll_OK || pool_unreserved(pool) == 0) {
+            STAT(pool->stats.exhausted++);
+            return NULL;
+        }
+    }
+    if (pool->free_list != GMB_DLLIST_NIL) {
+        n = TO_PTR(pool, pool->free_list);
+        pool->free_list = n->next; /* next free */
+    } else {
+        size_t seg_count = pool->blocks ? pool->blocks->count : pool->capacity;
+        if (pool->fresh == seg_count && pool_grow(pool) != gmbdll_OK) {
+            STAT(pool->stats.exhausted++);
+            return NULL;
+        }
+        gmbdll_Node *seg = pool->blocks ? pool->blocks->nodes : POOL_BASE(pool);
+        n = &seg[pool->fresh++];
+#if GMB_DLLIST_HANDLES
+        n->gen = pool->gen_floor;
+        n->owner = 0;
+#endif
+    }
+    n->next = GMB_DLLIST_NIL;
+    n->prev = GMB_DLLIST_NIL;
     n->data = NULL;
     pool->used++;
+    STAT(pool->stats.allocs++);
+    STAT_PEAK(pool->stats.peak_used, pool->used);
     return n;
 }
 
@@ -47,11 +202,294 @@ static gmbdll_Node *pool_alloc_node(gmbdll_Pool *pool) {
 static void pool_free_node(gmbdll_Pool *pool, gmbdll_Node *node) {
     if (!pool || !node) return;
     node->data = NULL;
-    node->prev = NULL;
+    node->prev = GMB_DLLIST_NIL;
     /* push node back to free_list */
     node->next = pool->free_list;
-    pool->free_list = node;
+    pool->free_list = TO_LINK(pool, node);
     if (pool->used > 0) pool->used--;
+    STAT(pool->stats.frees++);
+}
+
+/* Pool spinlocks: held only for batch refills/flushes and statistics.
+   Pools hash onto a fixed set of locks kept here rather than in
+   gmbdll_Pool, so the public structs hold no atomic types and a const
+   pool can still be locked. Pools sharing a lock only contend. */
+#define POOL_LOCKS 64
+
+static atomic_bool pool_locks[POOL_LOCKS];
+
+static atomic_bool *pool_lock_of(const gmbdll_Pool *pool) {
+    uintptr_t key = (uintptr_t)pool;
+    return &pool_locks[((key >> 4) ^ (key >> 12)) % POOL_LOCKS];
+}
+
+static void pool_lock(const gmbdll_Pool *pool) {
+    atomic_bool *lock = pool_lock_of(pool);
+    while (atomic_exchange_explicit(lock, 1, memory_order_acquire)) {
+        /* spin */
+    }
+}
+
+static void pool_unlock(const gmbdll_Pool *pool) {
+    atomic_store_explicit(pool_lock_of(pool), 0, memory_order_release);
+}
+
+/* Magazine count: written by the owning thread, read by
+   gmbdll_pool_used from others (relaxed atomic access). */
+#if defined(__GNUC__) || defined(__clang__)
+#define MAG_COUNT(mag)          __atomic_load_n(&(mag)->count, __ATOMIC_RELAXED)
+#define MAG_SET_COUNT(mag, c)   __atomic_store_n(&(mag)->count, (c), __ATOMIC_RELAXED)
+#else
+#define MAG_COUNT(mag)          (*(volatile size_t *)&(mag)->count)
+#define MAG_SET_COUNT(mag, c)   (*(volatile size_t *)&(mag)->count = (c))
+#endif
+
+/* Move up to half a magazine of nodes from the pool into an empty
+   magazine. Returns the new magazine count.
+   Here and in mag_flush the count changes under the pool lock, together
+   with pool->used, so gmbdll_pool_used never sees a node on both sides
+   (or on neither). */
+static size_t mag_refill(gmbdll_Magazine *mag) {
+    gmbdll_Pool *pool = mag->pool;
+    size_t count = 0;
+    pool_lock(pool);
+    while (count < GMB_DLLIST_MAGAZINE_SIZE / 2) {
+        gmbdll_Node *n = pool_alloc_node(pool, 0);
+        if (!n) break;
+        mag->nodes[count++] = TO_LINK(pool, n);
+    }
+    MAG_SET_COUNT(mag, count);
+    pool_unlock(pool);
+    return count;
+}
+
+/* Return the count oldest nodes of the magazine to the pool. */
+static void mag_flush(gmbdll_Magazine *mag, size_t count) {
+    gmbdll_Pool *pool = mag->pool;
+    size_t cached = MAG_COUNT(mag);
+    pool_lock(pool);
+    for (size_t i = 0; i < count; ++i) {
+        pool_free_node(pool, TO_PTR(pool, mag->nodes[i]));
+    }
+    MAG_SET_COUNT(mag, cached - count);
+    pool_unlock(pool);
+    /* the most recently freed (cache-hot) nodes stay; only this thread
+       reads the slots */
+    memmove(mag->nodes, mag->nodes + count, (cached - count) * sizeof(mag->nodes[0]));
+}
+
+/* Take one node from the magazine, refilling it from the pool if empty. */
+static gmbdll_Node *mag_alloc_node(gmbdll_Magazine *mag) {
+    size_t count = MAG_COUNT(mag);
+    if (count == 0) {
+        count = mag_refill(mag);
+        if (count == 0) return NULL;
+    }
+    count--;
+    gmbdll_Node *n = TO_PTR(mag->pool, mag->nodes[count]);
+    MAG_SET_COUNT(mag, count);
+    n->next = GMB_DLLIST_NIL;
+    n->prev = GMB_DLLIST_NIL;
+    n->data = NULL;
+    return n;
+}
+
+/* Cache a freed node in the magazine, flushing half of it if full. */
+static void mag_free_node(gmbdll_Magazine *mag, gmbdll_Node *node) {
+    size_t count = MAG_COUNT(mag);
+    if (count == GMB_DLLIST_MAGAZINE_SIZE) {
+        mag_flush(mag, GMB_DLLIST_MAGAZINE_SIZE / 2);
+        count -= GMB_DLLIST_MAGAZINE_SIZE / 2;
+    }
+    node->data = NULL;
+    mag->nodes[count] = TO_LINK(mag->pool, node);
+    MAG_SET_COUNT(mag, count + 1);
+}
+
+/* Unused part of the reservation of list, now and once charged nodes
+   are charged to it */
+#define LIST_OUTSTANDING(list)  LIST_OUTSTANDING_AT(list, (list)->charged)
+#define LIST_OUTSTANDING_AT(list, charged) \
+    ((charged) < (list)->reserve ? (list)->reserve - (charged) : 0)
+
+/* Set the node count charged to a list with limits, moving the change
+   in its unused reservation to the pool. */
+static void list_charge_to(gmbdll_List *list, size_t charged) {
+    size_t before = LIST_OUTSTANDING(list);
+    list->charged = charged;
+    list->pool->reserved = list->pool->reserved - before + LIST_OUTSTANDING(list);
+}
+
+/* Allocation for a list with a quota or reservation. */
+static gmbdll_Node *list_alloc_limited(gmbdll_List *list) {
+    if (list->quota && list->charged >= list->quota) return NULL;
+    int reserved = list->charged < list->reserve;
+    gmbdll_Node *n = list->mag ? mag_alloc_node(list->mag) : pool_alloc_node(list->pool, reserved);
+    if (n) list_charge_to(list, list->charged + 1);
+    return n;
+}
+
+/* Allocate / free a node for list: through its magazine if any. */
+static gmbdll_Node *list_alloc_node(gmbdll_List *list) {
+    gmbdll_Node *n;
+    if (list->quota || list->reserve) {
+        n = list_alloc_limited(list);
+    } else {
+        n = list->mag ? mag_alloc_node(list->mag) : pool_alloc_node(list->pool, 0);
+    }
+    if (n) NODE_CLAIM(list, n);
+    STAT(n ? list->stats.inserts++ : list->stats.insert_failures++);
+    return n;
+}
+
+static void list_free_node(gmbdll_List *list, gmbdll_Node *node) {
+    NODE_RELEASE(node);
+    if (list->quota || list->reserve) list_charge_to(list, list->charged - 1);
+    if (list->mag) {
+        mag_free_node(list->mag, node);
+    } else {
+        pool_free_node(list->pool, node);
+    }
+    STAT(list->stats.removes++);
+}
+
+/* Give back a node whose insertion failed after allocation (index full). */
+static void list_cancel_node(gmbdll_List *list, gmbdll_Node *node) {
+    list_free_node(list, node);
+    STAT((list->stats.inserts--, list->stats.removes--, list->stats.insert_failures++));
+}
+
+/* Link a free node into list before pos (pos NULL = at the end). */
+static void list_link_before(gmbdll_List *list, gmbdll_Node *pos, gmbdll_Node *node) {
+    gmbdll_Pool *pool = list->pool;
+    gmbdll_Node *before = pos ? PREV(pool, pos) : TAIL(list);
+    SET_PREV(pool, node, before);
+    SET_NEXT(pool, node, pos);
+    if (before) {
+        SET_NEXT(pool, before, node);
+    } else {
+        SET_HEAD(list, node);
+    }
+    if (pos) {
+        SET_PREV(pool, pos, node);
+    } else {
+        SET_TAIL(list, node);
+    }
+    list->size++;
+    STAT_PEAK(list->stats.peak_size, list->size);
+}
+
+#if GMB_DLLIST_HANDLES
+/* Hand the nodes from first on over to list (splice, split). */
+static void list_retag(gmbdll_List *list, gmbdll_Node *first) {
+    for (gmbdll_Node *n = first; n; n = NEXT(list->pool, n)) NODE_CLAIM(list, n);
+}
+#endif
+
+/* Unlink node from list without freeing it. */
+static void list_unlink(gmbdll_List *list, gmbdll_Node *node) {
+    gmbdll_Pool *pool = list->pool;
+    gmbdll_Node *prev = PREV(pool, node);
+    gmbdll_Node *next = NEXT(pool, node);
+
+    if (prev) {
+        prev->next = node->next;
+    } else {
+        /* node was head */
+        list->head = node->next;
+    }
+
+    if (next) {
+        next->prev = node->prev;
+    } else {
+        /* node was tail */
+        list->tail = node->prev;
+    }
+
+    list->size--;
+}
+
+/* ---------------------------
+   Hash index helpers
+   (no-ops when the list has no index)
+   --------------------------- */
+
+#define INDEX_KEY(index, data) \
+    ((index)->key_of ? (index)->key_of(data) : (const void *)(data))
+
+/* Add node to the list index. Returns -1 if the index is full. */
+static int index_insert(gmbdll_List *list, gmbdll_Node *node) {
+    gmbdll_Index *index = list->index;
+    if (!index) return gmbdll_OK;
+    if (index->count >= index->mask) return gmbdll_ERR; /* keep one empty slot */
+    size_t h = index->hash(INDEX_KEY(index, NODE_DATA(node)));
+    size_t i = h & index->mask;
+    while (index->slots[i].node != GMB_DLLIST_NIL) i = (i + 1) & index->mask;
+    index->slots[i].node = TO_LINK(list->pool, node);
+    index->slots[i].hash = h;
+    index->count++;
+    return gmbdll_OK;
+}
+
+/* Empty slot i, shifting back later entries of the same probe run
+   so lookups never need tombstones. */
+static void index_erase_slot(gmbdll_Index *index, size_t i) {
+    size_t j = i;
+    for (;;) {
+        j = (j + 1) & index->mask;
+        if (index->slots[j].node == GMB_DLLIST_NIL) break;
+        size_t k = index->slots[j].hash & index->mask; /* home slot */
+        /* entry at j stays if its home lies cyclically in (i, j] */
+        int stays = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+        if (stays) continue;
+        index->slots[i] = index->slots[j];
+        i = j;
+    }
+    index->slots[i].node = GMB_DLLIST_NIL;
+    index->count--;
+}
+
+/* Remove node from the list index. Must run before node->data is reset. */
+static void index_erase(gmbdll_List *list, gmbdll_Node *node) {
+    gmbdll_Index *index = list->index;
+    if (!index) return;
+    gmbdll_Link link = TO_LINK(list->pool, node);
+    size_t i = index->hash(INDEX_KEY(index, NODE_DATA(node))) & index->mask;
+    while (index->slots[i].node != link) {
+        if (index->slots[i].node == GMB_DLLIST_NIL) return; /* not indexed */
+        i = (i + 1) & index->mask;
+    }
+    index_erase_slot(index, i);
+}
+
+/* Find the slot holding key. Returns the slot number or SIZE_MAX. */
+static size_t index_lookup(gmbdll_List *list, const void *key) {
+    const gmbdll_Index *index = list->index;
+#if GMB_DLLIST_STATS
+    uint64_t t0 = GMB_DLLIST_STATS_CLOCK();
+    uint64_t probes = 0;
+#endif
+    size_t h = index->hash(key);
+    size_t i = h & index->mask;
+    size_t found = SIZE_MAX;
+    while (index->slots[i].node != GMB_DLLIST_NIL) {
+        STAT(probes++);
+        if (index->slots[i].hash == h &&
+            index->cmp(NODE_DATA(TO_PTR(list->pool, index->slots[i].node)), key) == 0) {
+            found = i;
+            break;
+        }
+        i = (i + 1) & index->mask;
+    }
+    STAT(stat_lookup(&list->stats.key_finds, &list->stats.key_probes, &list->stats.key_ticks,
+                     list->stats.key_hist, probes, t0));
+    return found;
+}
+
+/* Empty every slot of the index. */
+static void index_wipe(gmbdll_Index *index) {
+    for (size_t i = 0; i <= index->mask; ++i) index->slots[i].node = GMB_DLLIST_NIL;
+    index->count = 0;
 }
 
 /* ---------------------------
@@ -62,17 +500,224 @@ static void pool_free_node(gmbdll_Pool *pool, gmbdll_Node *node) {
 /* Initialize pool object. Must be called before using the pool. */
 int gmbdll_pool_init(gmbdll_Pool *pool) {
     if (!pool) return gmbdll_ERR;
-    pool_init(pool);
+    pool_init(pool, NULL, GMB_DLLIST_MAX_NODES);
+    return gmbdll_OK;
+}
+
+/* Initialize pool object on a caller-supplied node array. */
+int gmbdll_pool_init_buffer(gmbdll_Pool *pool, gmbdll_Node *buffer, size_t count) {
+    if (!pool || !buffer || count == 0) return gmbdll_ERR;
+#if GMB_DLLIST_INDEX_LINKS
+    if (count >= (size_t)GMB_DLLIST_NIL) return gmbdll_ERR;
+#endif
+    pool_init(pool, buffer, count);
+    return gmbdll_OK;
+}
+
+/* Enable growth by chained blocks (pointer links only). */
+int gmbdll_pool_set_growth(gmbdll_Pool *pool, size_t block_nodes,
+                           void *(*alloc_fn)(size_t size, void *ctx),
+                           void (*free_fn)(void *ptr, void *ctx), void *ctx) {
+    if (!pool || block_nodes == 0 || !alloc_fn || !free_fn) return gmbdll_ERR;
+#if GMB_DLLIST_INDEX_LINKS || GMB_DLLIST_HANDLES
+    (void)ctx;
+    return gmbdll_ERR;
+#else
+    pool->grow_nodes = block_nodes;
+    pool->grow_alloc = alloc_fn;
+    pool->grow_free = free_fn;
+    pool->grow_ctx = ctx;
     return gmbdll_OK;
+#endif
+}
+
+/* Release the blocks added by the growth policy. */
+void gmbdll_pool_destroy(gmbdll_Pool *pool) {
+    if (!pool) return;
+    gmbdll_Block *block = pool->blocks;
+    while (block) {
+        gmbdll_Block *next = block->next;
+        pool->capacity -= block->count;
+        pool->grow_free(block, pool->grow_ctx);
+        block = next;
+    }
+    pool->blocks = NULL;
+}
+
+/* Compact the nodes of lists to the front of the node array. */
+int gmbdll_pool_compact(gmbdll_Pool *pool, gmbdll_List *const *lists, size_t count) {
+    if (!pool || (!lists && count) || pool->blocks || pool->mags) return gmbdll_ERR;
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!lists[i] || lists[i]->pool != pool) return gmbdll_ERR;
+        /* a repeated list could make up for a missing one in total */
+        for (size_t j = 0; j < i; ++j) {
+            if (lists[j] == lists[i]) return gmbdll_ERR;
+        }
+        total += lists[i]->size;
+    }
+    if (total != pool->used) return gmbdll_ERR; /* a list is missing */
+    gmbdll_Node *base = POOL_BASE(pool);
+
+    /* 1. prev of each live node <- its new position (prev links are
+       rebuilt in step 3), NIL for free nodes */
+#if GMB_DLLIST_HANDLES
+    uint32_t gen = pool->gen_floor;
+#endif
+    for (size_t p = 0; p < pool->fresh; ++p) {
+        base[p].prev = GMB_DLLIST_NIL;
+#if GMB_DLLIST_HANDLES
+        if (base[p].gen > gen) gen = base[p].gen;
+#endif
+    }
+    size_t k = 0;
+    for (size_t i = 0; i < count; ++i) {
+        for (gmbdll_Node *n = HEAD(lists[i]); n; n = NEXT(pool, n), ++k) {
+            SET_PREV(pool, n, &base[k]); /* TO_LINK evaluates it twice */
+        }
+    }
+
+    /* 2. permute in place: each swap puts one node at its final position */
+    for (size_t p = 0; p < pool->fresh; ++p) {
+        while (base[p].prev != GMB_DLLIST_NIL) {
+            size_t t = (size_t)(PREV(pool, &base[p]) - base);
+            if (t == p) break;
+            gmbdll_Node tmp = base[t];
+            base[t] = base[p];
+            base[p] = tmp;
+        }
+    }
+
+#if GMB_DLLIST_HANDLES
+    /* every node moved: start a generation no handle has seen */
+    gen = gen + 1 ? gen + 1 : 1;
+    pool->gen_floor = gen;
+#endif
+    /* 3. relink each list as one contiguous run */
+    k = 0;
+    for (size_t i = 0; i < count; ++i) {
+        gmbdll_List *list = lists[i];
+        if (list->size == 0) {
+            list->head = GMB_DLLIST_NIL;
+            list->tail = GMB_DLLIST_NIL;
+            continue;
+        }
+        size_t first = k;
+        size_t last = k + list->size - 1;
+        for (; k <= last; ++k) {
+            SET_PREV(pool, &base[k], k > first ? &base[k - 1] : NULL);
+            SET_NEXT(pool, &base[k], k < last ? &base[k + 1] : NULL);
+#if GMB_DLLIST_HANDLES
+            base[k].gen = gen;
+#endif
+        }
+        SET_HEAD(list, &base[first]);
+        SET_TAIL(list, &base[last]);
+        if (list->index) gmbdll_list_attach_index(list, list->index); /* same size: fits */
+    }
+
+    /* the tail is never-used memory again */
+    pool->fresh = pool->used;
+    pool->free_list = GMB_DLLIST_NIL;
+    return gmbdll_OK;
+}
+
+/* Release the pages of the never-used tail of the node array. */
+size_t gmbdll_pool_trim(gmbdll_Pool *pool) {
+#if (defined(__unix__) || defined(__APPLE__)) && defined(MADV_DONTNEED)
+    if (!pool || pool->blocks) return 0; /* fresh counts the newest block */
+    long page = sysconf(_SC_PAGESIZE);
+    if (page <= 0) return 0;
+    gmbdll_Node *base = POOL_BASE(pool);
+    uintptr_t start = (uintptr_t)(base + pool->fresh);
+    uintptr_t end = (uintptr_t)(base + pool->capacity);
+    /* whole pages only: the neighbouring memory stays untouched */
+    start = (start + (uintptr_t)page - 1) / (uintptr_t)page * (uintptr_t)page;
+    end = end / (uintptr_t)page * (uintptr_t)page;
+    if (start >= end) return 0;
+    if (madvise((void *)start, end - start, MADV_DONTNEED) != 0) return 0;
+    return (size_t)(end - start);
+#else
+    (void)pool;
+    return 0;
+#endif
+}
+
+/* Register a magazine on pool. */
+int gmbdll_magazine_init(gmbdll_Magazine *mag, gmbdll_Pool *pool) {
+    if (!mag || !pool) return gmbdll_ERR;
+    mag->pool = pool;
+    MAG_SET_COUNT(mag, 0);
+    pool_lock(pool);
+    mag->next = pool->mags;
+    pool->mags = mag;
+    pool_unlock(pool);
+    return gmbdll_OK;
+}
+
+/* Flush every cached node and unregister the magazine. */
+void gmbdll_magazine_destroy(gmbdll_Magazine *mag) {
+    if (!mag || !mag->pool) return;
+    gmbdll_Pool *pool = mag->pool;
+    mag_flush(mag, MAG_COUNT(mag));
+    pool_lock(pool);
+    gmbdll_Magazine **link = &pool->mags;
+    while (*link && *link != mag) link = &(*link)->next;
+    if (*link) *link = mag->next;
+    pool_unlock(pool);
+    mag->pool = NULL;
+    mag->next = NULL;
 }
 
 /* Initialize a list and attach pool to it. pool must be valid and initialized. */
 int gmbdll_list_init(gmbdll_List *list, gmbdll_Pool *pool) {
     if (!list || !pool) return gmbdll_ERR;
-    list->head = NULL;
-    list->tail = NULL;
+    list->head = GMB_DLLIST_NIL;
+    list->tail = GMB_DLLIST_NIL;
     list->size = 0;
     list->pool = pool;
+    list->index = NULL;
+    list->mag = NULL;
+    list->reserve = 0;
+    list->quota = 0;
+    list->charged = 0;
+#if GMB_DLLIST_HANDLES
+    uint32_t tag;
+    do {
+        tag = (uint32_t)atomic_fetch_add_explicit(&list_tags, 1, memory_order_relaxed) + 1;
+    } while (tag == 0); /* 0 marks free nodes */
+    list->tag = tag;
+#endif
+#if GMB_DLLIST_STATS
+    memset(&list->stats, 0, sizeof(list->stats));
+#endif
+    return gmbdll_OK;
+}
+
+/* Route node allocation of list through a magazine (NULL = pool). */
+int gmbdll_list_set_magazine(gmbdll_List *list, gmbdll_Magazine *mag) {
+    if (!list || (mag && mag->pool != list->pool)) return gmbdll_ERR;
+    if (mag && list->reserve) return gmbdll_ERR; /* reservations live in the pool */
+    list->mag = mag;
+    return gmbdll_OK;
+}
+
+/* Set node quota and reservation of list. */
+int gmbdll_list_set_quota(gmbdll_List *list, size_t reserve, size_t quota) {
+    if (!list || !list->pool || (quota && reserve > quota)) return gmbdll_ERR;
+    if (reserve && list->mag) return gmbdll_ERR;
+    gmbdll_Pool *pool = list->pool;
+    /* charged is only kept while a limit is set: resync from size */
+    size_t charged = (list->quota || list->reserve) ? list->charged : list->size;
+    size_t old_out = LIST_OUTSTANDING(list);
+    size_t new_out = charged < reserve ? reserve - charged : 0;
+    if (new_out > old_out && pool_unreserved(pool) < new_out - old_out) {
+        return gmbdll_ERR; /* not enough free nodes to promise */
+    }
+    pool->reserved = pool->reserved - old_out + new_out;
+    list->reserve = reserve;
+    list->quota = quota;
+    list->charged = charged;
     return gmbdll_OK;
 }
 
@@ -88,92 +733,187 @@ size_t gmbdll_list_size(const gmbdll_List *list) {
     return list->size;
 }
 
+/* First / last node of the list, NULL if empty */
+gmbdll_Node *gmbdll_list_head(const gmbdll_List *list) {
+    if (!list) return NULL;
+    return HEAD(list);
+}
+
+gmbdll_Node *gmbdll_list_tail(const gmbdll_List *list) {
+    if (!list) return NULL;
+    return TAIL(list);
+}
+
+/* Neighbours of a node of this list, NULL at the ends */
+gmbdll_Node *gmbdll_node_next(const gmbdll_List *list, const gmbdll_Node *node) {
+    if (!list || !node) return NULL;
+    return NEXT(list->pool, node);
+}
+
+gmbdll_Node *gmbdll_node_prev(const gmbdll_List *list, const gmbdll_Node *node) {
+    if (!list || !node) return NULL;
+    return PREV(list->pool, node);
+}
+
 /* Push at front. Returns 0 on success, -1 on failure (pool exhausted). */
 int gmbdll_push_front(gmbdll_List *list, void *data) {
     if (!list || !list->pool) return gmbdll_ERR;
-    gmbdll_Node *node = pool_alloc_node(list->pool);
+    gmbdll_Pool *pool = list->pool;
+    gmbdll_Node *node = list_alloc_node(list);
     if (!node) return gmbdll_ERR;
+    gmbdll_Node *head = HEAD(list);
     node->data = data;
-    node->prev = NULL;
+    if (index_insert(list, node) != gmbdll_OK) {
+        list_cancel_node(list, node);
+        return gmbdll_ERR;
+    }
+    node->prev = GMB_DLLIST_NIL;
     node->next = list->head;
-    if (list->head) {
-        list->head->prev = node;
+    if (head) {
+        SET_PREV(pool, head, node);
     } else {
         /* empty list */
-        list->tail = node;
+        SET_TAIL(list, node);
     }
-    list->head = node;
+    SET_HEAD(list, node);
     list->size++;
+    STAT_PEAK(list->stats.peak_size, list->size);
     return gmbdll_OK;
 }
 
 /* Push at back. Returns 0 on success, -1 on failure (pool exhausted). */
 int gmbdll_push_back(gmbdll_List *list, void *data) {
     if (!list || !list->pool) return gmbdll_ERR;
-    gmbdll_Node *node = pool_alloc_node(list->pool);
+    gmbdll_Pool *pool = list->pool;
+    gmbdll_Node *node = list_alloc_node(list);
     if (!node) return gmbdll_ERR;
+    gmbdll_Node *tail = TAIL(list);
     node->data = data;
-    node->next = NULL;
+    if (index_insert(list, node) != gmbdll_OK) {
+        list_cancel_node(list, node);
+        return gmbdll_ERR;
+    }
+    node->next = GMB_DLLIST_NIL;
     node->prev = list->tail;
-    if (list->tail) {
-        list->tail->next = node;
+    if (tail) {
+        SET_NEXT(pool, tail, node);
     } else {
         /* empty list */
-        list->head = node;
+        SET_HEAD(list, node);
     }
-    list->tail = node;
+    SET_TAIL(list, node);
     list->size++;
+    STAT_PEAK(list->stats.peak_size, list->size);
     return gmbdll_OK;
 }
 
 /* Pop from front. Returns data pointer or NULL if empty. */
 void *gmbdll_pop_front(gmbdll_List *list) {
-    if (!list || !list->head) return NULL;
-    gmbdll_Node *old = list->head;
+    if (!list || list->head == GMB_DLLIST_NIL) return NULL;
+    gmbdll_Node *old = HEAD(list);
     void *data = old->data;
+    index_erase(list, old);
     list->head = old->next;
-    if (list->head) {
-        list->head->prev = NULL;
+    gmbdll_Node *head = HEAD(list);
+    if (head) {
+        head->prev = GMB_DLLIST_NIL;
     } else {
         /* became empty */
-        list->tail = NULL;
+        list->tail = GMB_DLLIST_NIL;
     }
     list->size--;
     /* return node to pool */
-    pool_free_node(list->pool, old);
+    list_free_node(list, old);
     return data;
 }
 
 /* Pop from back. Returns data pointer or NULL if empty. */
 void *gmbdll_pop_back(gmbdll_List *list) {
-    if (!list || !list->tail) return NULL;
-    gmbdll_Node *old = list->tail;
+    if (!list || list->tail == GMB_DLLIST_NIL) return NULL;
+    gmbdll_Node *old = TAIL(list);
     void *data = old->data;
+    index_erase(list, old);
     list->tail = old->prev;
-    if (list->tail) {
-        list->tail->next = NULL;
+    gmbdll_Node *tail = TAIL(list);
+    if (tail) {
+        tail->next = GMB_DLLIST_NIL;
     } else {
         /* became empty */
-        list->head = NULL;
+        list->head = GMB_DLLIST_NIL;
     }
     list->size--;
-    pool_free_node(list->pool, old);
+    list_free_node(list, old);
     return data;
 }
 
+/* Start a forward iteration at the head. */
+void gmbdll_iter_begin(gmbdll_Iter *it, const gmbdll_List *list) {
+    if (!it) return;
+    it->list = list;
+    it->node = list ? HEAD(list) : NULL;
+    it->reverse = 0;
+}
+
+/* Start a reverse iteration at the tail. */
+void gmbdll_iter_rbegin(gmbdll_Iter *it, const gmbdll_List *list) {
+    if (!it) return;
+    it->list = list;
+    it->node = list ? TAIL(list) : NULL;
+    it->reverse = 1;
+}
+
+/* Return the current node and step to its neighbour. */
+gmbdll_Node *gmbdll_iter_next(gmbdll_Iter *it) {
+    if (!it || !it->node) return NULL;
+    gmbdll_Node *node = it->node;
+    gmbdll_Pool *pool = it->list->pool;
+    it->node = it->reverse ? PREV(pool, node) : NEXT(pool, node);
+    /* start loading the following node while the caller works on this one */
+    if (it->node) PREFETCH(it->node);
+    return node;
+}
+
+/* Visit the list in batches of gathered element values. */
+size_t gmbdll_list_for_each_batch(const gmbdll_List *list,
+    int (*fn)(void *const *items, size_t count, void *ctx), void *ctx) {
+    if (!list || !fn) return 0;
+    void *items[GMB_DLLIST_BATCH];
+    size_t visited = 0;
+    gmbdll_Node *cur = HEAD(list);
+    while (cur) {
+        size_t count = 0;
+        while (cur && count < GMB_DLLIST_BATCH) {
+            gmbdll_Node *next = NEXT(list->pool, cur);
+            if (next) PREFETCH(next);
+            void *value = NODE_DATA(cur);
+            PREFETCH(value); /* the element fn will read */
+            items[count++] = value;
+            cur = next;
+        }
+        visited += count;
+        if (fn(items, count, ctx) != 0) break;
+    }
+    return visited;
+}
+
 /* Generic find: returns pointer to node or NULL.
    cmp callback: returns 0 if equal, non-zero otherwise.
    key is passed to cmp. */
 gmbdll_Node *gmbdll_list_find(gmbdll_List *list, int (*cmp)(const void *item, const void *key), const void *key) {
     if (!list || !cmp) return NULL;
-    gmbdll_Node *cur = list->head;
+#if GMB_DLLIST_STATS
+    uint64_t t0 = GMB_DLLIST_STATS_CLOCK();
+    uint64_t probes = 0;
+#endif
+    gmbdll_Node *cur = HEAD(list);
     while (cur) {
-        if (cmp(cur->data, key) == 0) {
-            return cur;
-        }
-        cur = cur->next;
+        STAT(probes++);
+        if (cmp(NODE_DATA(cur), key) == 0) break;
+        cur = NEXT(list->pool, cur);
     }
-    return NULL;
+    STAT(stat_lookup(&list->stats.finds, &list->stats.find_probes, &list->stats.find_ticks,
+                     list->stats.find_hist, probes, t0));
+    return cur;
 }
 
 /* Remove a node given its pointer. If data_out != NULL, store the data pointer there.
@@ -181,27 +921,72 @@ gmbdll_Node *gmbdll_list_find(gmbdll_List *list, int (*cmp)(const void *item, co
 int gmbdll_list_remove_node(gmbdll_List *list, gmbdll_Node *node, void **data_out) {
     if (!list || !node) return gmbdll_ERR;
 
-    /* Verify node belongs to this list is omitted for speed in embedded;
-       caller must ensure correctness. */
+    /* Full membership is not verified (that would be O(n)); with
+       GMB_DLLIST_HANDLES the owner tag rejects freed and foreign nodes. */
+    if (!NODE_OWNED(list, node)) return gmbdll_ERR;
 
-    if (node->prev) {
-        node->prev->next = node->next;
-    } else {
-        /* node was head */
-        list->head = node->next;
-    }
+    index_erase(list, node);
+    list_unlink(list, node);
 
-    if (node->next) {
-        node->next->prev = node->prev;
-    } else {
-        /* node was tail */
-        list->tail = node->prev;
+    if (data_out) *data_out = node->data;
+
+    list_free_node(list, node);
+    return gmbdll_OK;
+}
+
+/* Element of a node (payload address for inline nodes). */
+void *gmbdll_node_value(const gmbdll_Node *node) {
+    if (!node) return NULL;
+    return NODE_DATA(node);
+}
+
+#if GMB_DLLIST_PAYLOAD_SIZE > 0
+/* Copy value into a new inline node at the front or back. */
+static int push_copy(gmbdll_List *list, const void *value, size_t size, int front) {
+    if (!list || !list->pool || !value || size > GMB_DLLIST_PAYLOAD_SIZE) return gmbdll_ERR;
+    gmbdll_Node *node = list_alloc_node(list);
+    if (!node) return gmbdll_ERR;
+    memcpy(node->payload.bytes, value, size); /* data stays NULL: inline */
+    if (index_insert(list, node) != gmbdll_OK) {
+        list_cancel_node(list, node);
+        return gmbdll_ERR;
     }
+    list_link_before(list, front ? HEAD(list) : NULL, node);
+    return gmbdll_OK;
+}
 
-    if (data_out) *data_out = node->data;
+/* Copy the element of node into out, then remove the node. */
+static int pop_copy(gmbdll_List *list, gmbdll_Node *node, void *out, size_t size) {
+    if (!node || !out || size > GMB_DLLIST_PAYLOAD_SIZE) return gmbdll_ERR;
+    memcpy(out, NODE_DATA(node), size);
+    return gmbdll_list_remove_node(list, node, NULL);
+}
 
-    list->size--;
-    pool_free_node(list->pool, node);
+int gmbdll_push_front_copy(gmbdll_List *list, const void *value, size_t size) {
+    return push_copy(list, value, size, 1);
+}
+
+int gmbdll_push_back_copy(gmbdll_List *list, const void *value, size_t size) {
+    return push_copy(list, value, size, 0);
+}
+
+int gmbdll_pop_front_copy(gmbdll_List *list, void *out, size_t size) {
+    if (!list) return gmbdll_ERR;
+    return pop_copy(list, HEAD(list), out, size);
+}
+
+int gmbdll_pop_back_copy(gmbdll_List *list, void *out, size_t size) {
+    if (!list) return gmbdll_ERR;
+    return pop_copy(list, TAIL(list), out, size);
+}
+#endif
+
+/* Move a node of the list to the front without returning it to the pool. */
+int gmbdll_list_move_to_front(gmbdll_List *list, gmbdll_Node *node) {
+    if (!list || !node || !NODE_OWNED(list, node)) return gmbdll_ERR;
+    if (node->prev == GMB_DLLIST_NIL) return gmbdll_OK; /* already head */
+    list_unlink(list, node);
+    list_link_before(list, HEAD(list), node);
     return gmbdll_OK;
 }
 
@@ -209,53 +994,479 @@ int gmbdll_list_remove_node(gmbdll_List *list, gmbdll_Node *node, void **data_ou
    This frees all nodes back to the pool and resets list to empty. */
 void gmbdll_list_clear(gmbdll_List *list, void (*free_func)(void *)) {
     if (!list) return;
-    gmbdll_Node *cur = list->head;
+    gmbdll_Index *index = list->index;
+    /* a nearly-empty list erases its entries, otherwise wipe all slots */
+    int erase_each = index && list->size * 4 < index->mask + 1;
+    if (index && !erase_each) index_wipe(index);
+    gmbdll_Node *cur = HEAD(list);
     while (cur) {
-        gmbdll_Node *next = cur->next;
+        gmbdll_Node *next = NEXT(list->pool, cur);
+        if (erase_each) index_erase(list, cur);
         if (free_func && cur->data) {
             free_func(cur->data);
         }
-        pool_free_node(list->pool, cur);
+        list_free_node(list, cur);
         cur = next;
     }
-    list->head = NULL;
-    list->tail = NULL;
+    list->head = GMB_DLLIST_NIL;
+    list->tail = GMB_DLLIST_NIL;
     list->size = 0;
 }
 
+/* Push n elements at back. Nodes are chained privately, then attached once.
+   Returns the number of elements pushed. */
+size_t gmbdll_push_back_n(gmbdll_List *list, void *const *items, size_t n) {
+    if (!list || !list->pool || (!items && n)) return 0;
+    gmbdll_Pool *pool = list->pool;
+    gmbdll_Node *first = NULL;
+    gmbdll_Node *last = NULL;
+    size_t count = 0;
+    while (count < n) {
+        gmbdll_Node *node = list_alloc_node(list);
+        if (!node) break; /* pool exhausted, keep what we have */
+        node->data = items[count];
+        if (index_insert(list, node) != gmbdll_OK) {
+            list_cancel_node(list, node);
+            break;
+        }
+        SET_PREV(pool, node, last);
+        if (last) {
+            SET_NEXT(pool, last, node);
+        } else {
+            first = node;
+        }
+        last = node;
+        count++;
+    }
+    if (!first) return 0;
+    /* attach the chain after the current tail */
+    first->prev = list->tail;
+    gmbdll_Node *tail = TAIL(list);
+    if (tail) {
+        SET_NEXT(pool, tail, first);
+    } else {
+        SET_HEAD(list, first);
+    }
+    SET_TAIL(list, last);
+    list->size += count;
+    STAT_PEAK(list->stats.peak_size, list->size);
+    return count;
+}
+
+/* Pop up to n elements from front. Returns the number of elements popped. */
+size_t gmbdll_pop_front_n(gmbdll_List *list, void **out, size_t n) {
+    if (!list || !list->pool || (!out && n)) return 0;
+    gmbdll_Pool *pool = list->pool;
+    gmbdll_Node *first = HEAD(list);
+    gmbdll_Node *last = NULL;
+    gmbdll_Node *cur = first;
+    size_t count = 0;
+    while (cur && count < n) {
+        index_erase(list, cur);
+        NODE_RELEASE(cur);
+        out[count++] = cur->data;
+        last = cur;
+        cur = NEXT(pool, cur);
+    }
+    if (count == 0) return 0;
+    /* detach [first, last] */
+    SET_HEAD(list, cur);
+    if (cur) {
+        cur->prev = GMB_DLLIST_NIL;
+    } else {
+        list->tail = GMB_DLLIST_NIL;
+    }
+    list->size -= count;
+    STAT(list->stats.removes += count);
+    if (list->quota || list->reserve) list_charge_to(list, list->charged - count);
+    if (list->mag) {
+        for (cur = first; cur != last; ) {
+            gmbdll_Node *next = NEXT(pool, cur);
+            mag_free_node(list->mag, cur);
+            cur = next;
+        }
+        mag_free_node(list->mag, last);
+        return count;
+    }
+    /* the chain is already linked through next: push it on free_list whole */
+    last->next = pool->free_list;
+    pool->free_list = TO_LINK(pool, first);
+    pool->used -= count;
+    STAT(pool->stats.frees += count);
+    return count;
+}
+
+/* Move all nodes of src before pos in dst. O(1). */
+int gmbdll_list_splice(gmbdll_List *dst, gmbdll_Node *pos, gmbdll_List *src) {
+    if (!dst || !src || dst == src || dst->pool != src->pool) return gmbdll_ERR;
+    if (dst->index || src->index) return gmbdll_ERR;
+    if (src->size == 0) return gmbdll_OK;
+    if (dst->quota && dst->charged + src->size > dst->quota) return gmbdll_ERR;
+    /* the nodes stay allocated: src gets its reservation back only if
+       free nodes can back it (net of what dst's reservation releases) */
+    size_t src_grows = src->reserve ? LIST_OUTSTANDING_AT(src, 0) - LIST_OUTSTANDING(src) : 0;
+    size_t dst_frees = dst->reserve
+        ? LIST_OUTSTANDING(dst) - LIST_OUTSTANDING_AT(dst, dst->charged + src->size) : 0;
+    if (src_grows > dst_frees && pool_unreserved(dst->pool) < src_grows - dst_frees) {
+        return gmbdll_ERR;
+    }
+    if (dst->quota || dst->reserve) list_charge_to(dst, dst->charged + src->size);
+    if (src->quota || src->reserve) list_charge_to(src, 0);
+    gmbdll_Pool *pool = dst->pool;
+    gmbdll_Node *first = HEAD(src);
+    gmbdll_Node *last = TAIL(src);
+    gmbdll_Node *before = pos ? PREV(pool, pos) : TAIL(dst);
+#if GMB_DLLIST_HANDLES
+    list_retag(dst, first);
+#endif
+
+    SET_PREV(pool, first, before);
+    if (before) {
+        SET_NEXT(pool, before, first);
+    } else {
+        SET_HEAD(dst, first);
+    }
+
+    SET_NEXT(pool, last, pos);
+    if (pos) {
+        SET_PREV(pool, pos, last);
+    } else {
+        SET_TAIL(dst, last);
+    }
+
+    dst->size += src->size;
+    STAT_PEAK(dst->stats.peak_size, dst->size);
+    src->head = GMB_DLLIST_NIL;
+    src->tail = GMB_DLLIST_NIL;
+    src->size = 0;
+    return gmbdll_OK;
+}
+
+/* Move all nodes of src to the end of dst. O(1). */
+int gmbdll_list_concat(gmbdll_List *dst, gmbdll_List *src) {
+    return gmbdll_list_splice(dst, NULL, src);
+}
+
+/* Move node and all following nodes into out. */
+int gmbdll_list_split_at(gmbdll_List *list, gmbdll_Node *node, gmbdll_List *out) {
+    if (!list || !node || !out || out == list || list->index) return gmbdll_ERR;
+    /* re-initializing out would leak its nodes or its reservation */
+    if (out->size || out->index || out->quota || out->reserve) return gmbdll_ERR;
+    gmbdll_Pool *pool = list->pool;
+
+    /* count the moved part (the only non-O(1) step) */
+    size_t moved = 0;
+    for (const gmbdll_Node *cur = node; cur; cur = NEXT(pool, cur)) moved++;
+    /* as in splice: the reservation list gets back needs free nodes */
+    if (list->reserve &&
+        pool_unreserved(pool) < LIST_OUTSTANDING_AT(list, list->charged - moved) - LIST_OUTSTANDING(list)) {
+        return gmbdll_ERR;
+    }
+
+    gmbdll_list_init(out, pool);
+#if GMB_DLLIST_HANDLES
+    list_retag(out, node);
+#endif
+    if (list->quota || list->reserve) list_charge_to(list, list->charged - moved);
+    out->mag = list->mag;
+    out->tail = list->tail;
+    SET_HEAD(out, node);
+    out->size = moved;
+
+    list->tail = node->prev;
+    gmbdll_Node *tail = TAIL(list);
+    if (tail) {
+        tail->next = GMB_DLLIST_NIL;
+    } else {
+        list->head = GMB_DLLIST_NIL;
+    }
+    list->size -= moved;
+    node->prev = GMB_DLLIST_NIL;
+    return gmbdll_OK;
+}
+
+/* Sort in place: bottom-up merge sort over next links.
+   Each pass merges runs of insize nodes; prev links are rebuilt while
+   merging, so no extra fix-up walk is needed. */
+void gmbdll_list_sort(gmbdll_List *list, int (*cmp)(const void *item, const void *key)) {
+    if (!list || !cmp || list->size < 2) return;
+#if GMB_DLLIST_STATS
+    uint64_t t0 = GMB_DLLIST_STATS_CLOCK();
+#endif
+    gmbdll_Pool *pool = list->pool;
+    gmbdll_Node *head = HEAD(list);
+    gmbdll_Node *tail;
+    size_t insize = 1;
+
+    for (;;) {
+        gmbdll_Node *p = head;
+        size_t nmerges = 0;
+        head = NULL;
+        tail = NULL;
+
+        while (p) {
+            gmbdll_Node *q = p;
+            size_t psize = 0;
+            size_t qsize = insize;
+            nmerges++;
+            while (q && psize < insize) {
+                psize++;
+                q = NEXT(pool, q);
+            }
+
+            /* merge run p (psize) with run q (up to qsize) */
+            while (psize > 0 || (qsize > 0 && q)) {
+                gmbdll_Node *e;
+                if (psize == 0) {
+                    e = q; q = NEXT(pool, q); qsize--;
+                } else if (qsize == 0 || !q || cmp(NODE_DATA(p), NODE_DATA(q)) <= 0) {
+                    e = p; p = NEXT(pool, p); psize--;
+                } else {
+                    e = q; q = NEXT(pool, q); qsize--;
+                }
+                if (tail) {
+                    SET_NEXT(pool, tail, e);
+                } else {
+                    head = e;
+                }
+                SET_PREV(pool, e, tail);
+                tail = e;
+            }
+            p = q;
+        }
+
+        tail->next = GMB_DLLIST_NIL;
+        if (nmerges <= 1) break;
+        insize *= 2;
+    }
+
+    SET_HEAD(list, head);
+    SET_TAIL(list, tail);
+    STAT((list->stats.sorts++,
+          list->stats.sort_ticks += (uint64_t)GMB_DLLIST_STATS_CLOCK() - t0));
+}
+
+/* Sorted insert, after equal elements, starting from an optional hint. */
+gmbdll_Node *gmbdll_list_insert_sorted(gmbdll_List *list, void *data,
+    int (*cmp)(const void *item, const void *key), gmbdll_Node *hint) {
+    if (!list || !list->pool || !cmp) return NULL;
+    gmbdll_Pool *pool = list->pool;
+    gmbdll_Node *pos; /* insert before pos, NULL = at the end */
+
+    gmbdll_Node *tail = TAIL(list);
+    if (!tail || cmp(NODE_DATA(tail), data) <= 0) {
+        pos = NULL; /* append: the common case for increasing keys */
+    } else if (hint && cmp(NODE_DATA(hint), data) <= 0) {
+        /* walk forward from the hint */
+        pos = NEXT(pool, hint);
+        while (pos && cmp(NODE_DATA(pos), data) <= 0) pos = NEXT(pool, pos);
+    } else if (hint) {
+        /* walk backward from the hint */
+        pos = hint;
+        gmbdll_Node *prev = PREV(pool, pos);
+        while (prev && cmp(NODE_DATA(prev), data) > 0) {
+            pos = prev;
+            prev = PREV(pool, pos);
+        }
+    } else {
+        pos = HEAD(list);
+        while (pos && cmp(NODE_DATA(pos), data) <= 0) pos = NEXT(pool, pos);
+    }
+
+    gmbdll_Node *node = list_alloc_node(list);
+    if (!node) return NULL;
+    node->data = data;
+    if (index_insert(list, node) != gmbdll_OK) {
+        list_cancel_node(list, node);
+        return NULL;
+    }
+    list_link_before(list, pos, node);
+    return node;
+}
+
+/* Initialize a hash index on a caller slot buffer. */
+int gmbdll_index_init(gmbdll_Index *index, gmbdll_IndexSlot *slots, size_t nslots,
+                      const void *(*key_of)(const void *data),
+                      size_t (*hash)(const void *key),
+                      int (*cmp)(const void *item, const void *key)) {
+    if (!index || !slots || !hash || !cmp) return gmbdll_ERR;
+    if (nslots < 2 || (nslots & (nslots - 1)) != 0) return gmbdll_ERR;
+    index->slots = slots;
+    index->mask = nslots - 1;
+    index->key_of = key_of;
+    index->hash = hash;
+    index->cmp = cmp;
+    index_wipe(index);
+    return gmbdll_OK;
+}
+
+/* Attach index to list (NULL detaches) and index existing nodes. */
+int gmbdll_list_attach_index(gmbdll_List *list, gmbdll_Index *index) {
+    if (!list) return gmbdll_ERR;
+    list->index = index;
+    if (!index) return gmbdll_OK;
+    index_wipe(index);
+    for (gmbdll_Node *cur = HEAD(list); cur; cur = NEXT(list->pool, cur)) {
+        if (index_insert(list, cur) != gmbdll_OK) {
+            index_wipe(index);
+            list->index = NULL;
+            return gmbdll_ERR;
+        }
+    }
+    return gmbdll_OK;
+}
+
+/* O(1) lookup through the attached index. */
+gmbdll_Node *gmbdll_list_find_key(gmbdll_List *list, const void *key) {
+    if (!list || !list->index) return NULL;
+    size_t slot = index_lookup(list, key);
+    if (slot == SIZE_MAX) return NULL;
+    return TO_PTR(list->pool, list->index->slots[slot].node);
+}
+
+/* O(1) find + remove through the attached index. */
+int gmbdll_list_remove_key(gmbdll_List *list, const void *key, void **data_out) {
+    if (!list || !list->index) return gmbdll_ERR;
+    size_t slot = index_lookup(list, key);
+    if (slot == SIZE_MAX) return gmbdll_ERR;
+    gmbdll_Node *node = TO_PTR(list->pool, list->index->slots[slot].node);
+    index_erase_slot(list->index, slot);
+    list_unlink(list, node);
+    if (data_out) *data_out = node->data;
+    list_free_node(list, node);
+    return gmbdll_OK;
+}
+
 /* Optional: expose pool statistics */
 size_t gmbdll_pool_capacity(const gmbdll_Pool *pool) {
     if (!pool) return 0;
     return pool->capacity;
 }
 
+/* Nodes handed to magazines count as used by the pool until flushed:
+   subtract what the magazines still cache. */
 size_t gmbdll_pool_used(const gmbdll_Pool *pool) {
     if (!pool) return 0;
-    return pool->used;
+    if (!pool->mags) return pool->used; /* single-threaded use, no lock */
+    pool_lock(pool);
+    size_t used = pool->used;
+    for (const gmbdll_Magazine *mag = pool->mags; mag; mag = mag->next) {
+        used -= MAG_COUNT(mag);
+    }
+    pool_unlock(pool);
+    return used;
+}
+
+#if GMB_DLLIST_HANDLES
+/* Handle of a node owned by list. */
+gmbdll_Handle gmbdll_node_handle(const gmbdll_List *list, const gmbdll_Node *node) {
+    gmbdll_Handle handle = {0, 0, 0};
+    if (!list || !node || !NODE_OWNED(list, node)) return handle;
+    handle.index = (uint32_t)(node - POOL_BASE(list->pool));
+    handle.gen = node->gen;
+    handle.owner = list->tag;
+    return handle;
 }
 
+/* Resolve a handle: owner, bounds and generation checks, all O(1). The
+   owner check also rejects handles taken in another pool. */
+gmbdll_Node *gmbdll_handle_node(const gmbdll_List *list, gmbdll_Handle handle) {
+    if (!list || !list->pool || handle.owner != list->tag) return NULL;
+    /* nodes past fresh were never handed out (and never written) */
+    if (handle.index >= list->pool->fresh) return NULL;
+    gmbdll_Node *node = &POOL_BASE(list->pool)[handle.index];
+    if (node->gen != handle.gen || !NODE_OWNED(list, node)) return NULL;
+    return node;
+}
+
+/* Checked remove through a handle. */
+int gmbdll_list_remove_handle(gmbdll_List *list, gmbdll_Handle handle, void **data_out) {
+    gmbdll_Node *node = gmbdll_handle_node(list, handle);
+    if (!node) return gmbdll_ERR;
+    return gmbdll_list_remove_node(list, node, data_out);
+}
+#endif
+
+#if GMB_DLLIST_STATS
+/* Zero the pool counters; the peak restarts from the current use. */
+void gmbdll_pool_stats_reset(gmbdll_Pool *pool) {
+    if (!pool) return;
+    memset(&pool->stats, 0, sizeof(pool->stats));
+    pool->stats.peak_used = pool->used;
+}
+
+/* Zero the list counters; the peak restarts from the current size. */
+void gmbdll_list_stats_reset(gmbdll_List *list) {
+    if (!list) return;
+    memset(&list->stats, 0, sizeof(list->stats));
+    list->stats.peak_size = list->size;
+}
+
+/* Print a histogram as a JSON array. */
+static void stats_hist_json(FILE *out, const char *key, const uint64_t *hist) {
+    fprintf(out, ",\"%s\":[", key);
+    for (size_t i = 0; i < GMB_DLLIST_STATS_BUCKETS; ++i) {
+        fprintf(out, "%s%llu", i ? "," : "", (unsigned long long)hist[i]);
+    }
+    fputc(']', out);
+}
+
+/* One JSON object per line with the pool counters. */
+int gmbdll_pool_stats_json(const gmbdll_Pool *pool, const char *name, FILE *out) {
+    if (!pool || !out) return gmbdll_ERR;
+    const gmbdll_PoolStats *st = &pool->stats;
+    fprintf(out, "{\"type\":\"gmbdll_pool\",\"name\":\"%s\",\"capacity\":%zu,"
+            "\"used\":%zu,\"peak_used\":%zu,\"allocs\":%llu,\"frees\":%llu,"
+            "\"exhausted\":%llu,\"grows\":%llu}\n",
+            name ? name : "", gmbdll_pool_capacity(pool), gmbdll_pool_used(pool),
+            st->peak_used, (unsigned long long)st->allocs, (unsigned long long)st->frees,
+            (unsigned long long)st->exhausted, (unsigned long long)st->grows);
+    return ferror(out) ? gmbdll_ERR : gmbdll_OK;
+}
+
+/* One JSON object per line with the list counters and histograms. */
+int gmbdll_list_stats_json(const gmbdll_List *list, const char *name, FILE *out) {
+    if (!list || !out) return gmbdll_ERR;
+    const gmbdll_ListStats *st = &list->stats;
+    fprintf(out, "{\"type\":\"gmbdll_list\",\"name\":\"%s\",\"size\":%zu,"
+            "\"peak_size\":%zu,\"inserts\":%llu,\"insert_failures\":%llu,"
+            "\"removes\":%llu,\"finds\":%llu,\"find_probes\":%llu,\"find_ticks\":%llu",
+            name ? name : "", list->size, st->peak_size,
+            (unsigned long long)st->inserts, (unsigned long long)st->insert_failures,
+            (unsigned long long)st->removes, (unsigned long long)st->finds,
+            (unsigned long long)st->find_probes, (unsigned long long)st->find_ticks);
+    stats_hist_json(out, "find_hist", st->find_hist);
+    fprintf(out, ",\"key_finds\":%llu,\"key_probes\":%llu,\"key_ticks\":%llu",
+            (unsigned long long)st->key_finds, (unsigned long long)st->key_probes,
+            (unsigned long long)st->key_ticks);
+    stats_hist_json(out, "key_hist", st->key_hist);
+    fprintf(out, ",\"sorts\":%llu,\"sort_ticks\":%llu}\n",
+            (unsigned long long)st->sorts, (unsigned long long)st->sort_ticks);
+    return ferror(out) ? gmbdll_ERR : gmbdll_OK;
+}
+#endif
+
 /* Debug: print list of integers (for testing only) */
 void gmbdll_print_int(const gmbdll_List *list) {
-    if (list == NULL || list->head == NULL) {
+    if (list == NULL || list->head == GMB_DLLIST_NIL) {
         printf("[empty]\n");
         return;
     }
 
-    const gmbdll_Node *current = list->head;
+    const gmbdll_Node *current = HEAD(list);
     printf("List (%zu elements): ", list->size);
 
     while (current != NULL) {
-        int *value = (int *)current->data;
+        int *value = (int *)NODE_DATA(current);
         if (value != NULL) {
             printf("%d ", *value);
         } else {
             printf("(null) ");
         }
-        current = current->next;
+        current = NEXT(list->pool, current);
     }
 
     printf("\n");
 }
 
 /* End of file */
-
@@ -15,11 +15,76 @@
  * Configuration
  * ================================ */
 
-/* Maximum number of nodes in the pool */
+/* Number of nodes built into gmbdll_Pool. Pools initialized from a
+   caller buffer (gmbdll_pool_init_buffer) do not use this array, so
+   such builds may set it as low as 1. */
 #ifndef GMB_DLLIST_MAX_NODES
 #define GMB_DLLIST_MAX_NODES 64
 #endif
 
+/* Link representation inside the pool:
+   0  = full pointers (default)
+   16 = 16-bit indices into the pool node array
+   32 = 32-bit indices into the pool node array
+   Index links make nodes smaller and keep pool + lists free of absolute
+   addresses, so a pool can be copied, relocated or mapped without fixups
+   (lists only need their pool pointer updated). */
+#ifndef GMB_DLLIST_INDEX_LINKS
+#define GMB_DLLIST_INDEX_LINKS 0
+#endif
+
+/* Bytes of inline payload per node (0 = none). With a payload, fixed-size
+   values can be copied into the node itself (gmbdll_push_back_copy...)
+   instead of being allocated separately and linked through data. */
+#ifndef GMB_DLLIST_PAYLOAD_SIZE
+#define GMB_DLLIST_PAYLOAD_SIZE 0
+#endif
+
+/* Nodes cached by each gmbdll_Magazine. Refills and flushes move half
+   of this many nodes between the magazine and the shared pool. */
+#ifndef GMB_DLLIST_MAGAZINE_SIZE
+#define GMB_DLLIST_MAGAZINE_SIZE 32
+#endif
+
+#if GMB_DLLIST_MAGAZINE_SIZE < 2
+#error "GMB_DLLIST_MAGAZINE_SIZE must be at least 2"
+#endif
+
+/* Elements gathered per callback by gmbdll_list_for_each_batch */
+#ifndef GMB_DLLIST_BATCH
+#define GMB_DLLIST_BATCH 32
+#endif
+
+/* Statistics layer (0 = compiled out, no fields and no code).
+   With 1, pools and lists keep counters, peaks and lookup probe
+   histograms, dumped as JSON by gmbdll_pool_stats_json() and
+   gmbdll_list_stats_json(). */
+#ifndef GMB_DLLIST_STATS
+#define GMB_DLLIST_STATS 0
+#endif
+
+/* Timing hook for the statistics layer: an expression returning the
+   current time as uint64_t in any unit (ns, cycles...). find, find_key
+   and sort accumulate it. Default 0: no timing. */
+#ifndef GMB_DLLIST_STATS_CLOCK
+#define GMB_DLLIST_STATS_CLOCK() 0
+#endif
+
+/* Generation-checked handles (0 = compiled out). With 1, each node
+   carries a generation, bumped whenever it is freed, and the tag of the
+   list owning it. gmbdll_Handle values then resolve and remove in O(1)
+   and fail once the node was freed or reused, and remove_node /
+   move_to_front reject nodes the list does not own. Costs 8 bytes per
+   node; splice, concat and split_at retag the moved nodes (O(moved)),
+   and pools cannot grow by blocks. */
+#ifndef GMB_DLLIST_HANDLES
+#define GMB_DLLIST_HANDLES 0
+#endif
+
+/* Probe histogram buckets: bucket b counts lookups that probed
+   [2^(b-1), 2^b) entries (bucket 0: none), the last one all longer */
+#define GMB_DLLIST_STATS_BUCKETS 16
+
 /* Return codes */
 #define gmbdll_OK    0
 #define gmbdll_ERR  -1
@@ -29,50 +94,279 @@
  * ================================ */
 typedef struct gmbdll_Node gmbdll_Node;
 typedef struct gmbdll_Pool gmbdll_Pool;
+typedef struct gmbdll_Block gmbdll_Block;
+typedef struct gmbdll_Magazine gmbdll_Magazine;
+
+/* Link type: a node pointer, or an index into the pool node array */
+#if GMB_DLLIST_INDEX_LINKS == 0
+typedef gmbdll_Node *gmbdll_Link;
+#define GMB_DLLIST_NIL ((gmbdll_Link)NULL)
+#elif GMB_DLLIST_INDEX_LINKS == 16
+typedef uint16_t gmbdll_Link;
+#define GMB_DLLIST_NIL ((gmbdll_Link)UINT16_MAX)
+#elif GMB_DLLIST_INDEX_LINKS == 32
+typedef uint32_t gmbdll_Link;
+#define GMB_DLLIST_NIL ((gmbdll_Link)UINT32_MAX)
+#else
+#error "GMB_DLLIST_INDEX_LINKS must be 0, 16 or 32"
+#endif
+
+#if GMB_DLLIST_INDEX_LINKS == 16 && GMB_DLLIST_MAX_NODES >= 0xFFFF
+#error "GMB_DLLIST_MAX_NODES too large for 16-bit links"
+#endif
 
 /* ================================
  * Data structures
  * ================================ */
 
-/* Node structure */
+/* Node structure. With index links, walk a list through
+   gmbdll_node_next()/gmbdll_node_prev() instead of next/prev.
+   A node whose value was copied in has data == NULL and keeps the value
+   in payload; gmbdll_node_value() returns the element either way. */
 typedef struct gmbdll_Node {
     void *data;
-    gmbdll_Node *next;
-    gmbdll_Node *prev;
+    gmbdll_Link next;
+    gmbdll_Link prev;
+#if GMB_DLLIST_HANDLES
+    uint32_t gen;  /* Generation, bumped when the node is freed, never 0 */
+    uint32_t owner;  /* Tag of the owning list, 0 = free */
+#endif
+#if GMB_DLLIST_PAYLOAD_SIZE > 0
+    union {
+        unsigned char bytes[GMB_DLLIST_PAYLOAD_SIZE];
+        void *align_ptr;
+        long long align_ll;
+        double align_d;
+    } payload;
+#endif
 } gmbdll_Node;
 
+/* Extra node block chained to a pool by the growth policy */
+struct gmbdll_Block {
+    gmbdll_Block *next;
+    size_t count;
+    gmbdll_Node nodes[];
+};
+
+#if GMB_DLLIST_HANDLES
+/* Checked reference to a node: its position in the pool array, the
+   generation it had when the handle was taken and the tag of the list
+   owning it then. Stays valid while the node is in the same list; moving
+   it to another list (splice, concat, split_at) invalidates the handle.
+   A zero-initialized handle is never valid. */
+typedef struct gmbdll_Handle {
+    uint32_t index;
+    uint32_t gen;
+    uint32_t owner;
+} gmbdll_Handle;
+#endif
+
+#if GMB_DLLIST_STATS
+/* Pool counters. With magazines they count batch refills/flushes
+   at the pool, not per-list traffic. */
+typedef struct gmbdll_PoolStats {
+    uint64_t allocs;  /* Nodes handed out */
+    uint64_t frees;  /* Nodes returned */
+    uint64_t exhausted;  /* Allocations that failed */
+    uint64_t grows;  /* Blocks added by the growth policy */
+    size_t peak_used;  /* High-water mark of used */
+} gmbdll_PoolStats;
+
+/* List counters */
+typedef struct gmbdll_ListStats {
+    uint64_t inserts;  /* Elements added (push, insert_sorted...) */
+    uint64_t insert_failures;  /* Pool exhausted or index full */
+    uint64_t removes;  /* Elements removed (pop, remove, clear...) */
+    size_t peak_size;  /* High-water mark of size */
+    uint64_t finds;  /* gmbdll_list_find calls */
+    uint64_t find_probes;  /* Nodes compared by them */
+    uint64_t find_ticks;  /* GMB_DLLIST_STATS_CLOCK time spent in them */
+    uint64_t find_hist[GMB_DLLIST_STATS_BUCKETS];
+    uint64_t key_finds;  /* Hash index lookups (find_key, remove_key) */
+    uint64_t key_probes;  /* Slots visited by them */
+    uint64_t key_ticks;
+    uint64_t key_hist[GMB_DLLIST_STATS_BUCKETS];
+    uint64_t sorts;
+    uint64_t sort_ticks;
+} gmbdll_ListStats;
+#endif
+
 /* Node pool structure */
 typedef struct gmbdll_Pool{
     gmbdll_Node nodes[GMB_DLLIST_MAX_NODES];
-    gmbdll_Node *free_list;  /* List of free nodes */
+    gmbdll_Node *buf;  /* Caller node buffer, NULL = nodes[] above */
+    gmbdll_Link free_list;  /* List of recycled nodes */
+    size_t fresh;  /* Never-used nodes handed out from the newest segment */
     size_t capacity;  /* Total capacity of the pool */
     size_t used;  /* Number of nodes currently in use */
+    /* Optional growth policy */
+    gmbdll_Block *blocks;  /* Chain of extra blocks */
+    size_t grow_nodes;  /* Nodes per extra block, 0 = fixed size */
+    void *(*grow_alloc)(size_t size, void *ctx);
+    void (*grow_free)(void *ptr, void *ctx);
+    void *grow_ctx;
+    /* Sharing between threads through magazines (the pool lock lives
+       in gmbdllist.c, so this header stays usable from C++) */
+    gmbdll_Magazine *mags;  /* Registered magazines */
+    size_t reserved;  /* Nodes reserved by lists and not yet allocated */
+#if GMB_DLLIST_HANDLES
+    uint32_t gen_floor;  /* Generation of never-used nodes, raised by compaction */
+#endif
+#if GMB_DLLIST_STATS
+    gmbdll_PoolStats stats;
+#endif
 } gmbdll_Pool;
 
+/* Per-thread node cache in front of a shared pool. Lists attached to a
+   magazine (gmbdll_list_set_magazine) allocate and free nodes in the
+   local stack and only lock the pool to move nodes in batches. */
+struct gmbdll_Magazine {
+    gmbdll_Pool *pool;
+    gmbdll_Magazine *next;  /* Pool registry */
+    size_t count;  /* Cached nodes, read atomically by gmbdll_pool_used */
+    gmbdll_Link nodes[GMB_DLLIST_MAGAZINE_SIZE];
+};
+
+/* Hash index slot. node == GMB_DLLIST_NIL marks an empty slot. */
+typedef struct gmbdll_IndexSlot {
+    gmbdll_Link node;
+    size_t hash;
+} gmbdll_IndexSlot;
+
+/* Optional open-addressing (linear probing) hash index mapping keys to
+   the nodes of one list. Slots come from a caller buffer. */
+typedef struct gmbdll_Index {
+    gmbdll_IndexSlot *slots;
+    size_t mask;  /* slot count - 1, slot count is a power of two */
+    size_t count;  /* Number of indexed nodes */
+    const void *(*key_of)(const void *data);  /* NULL = data is the key */
+    size_t (*hash)(const void *key);
+    int (*cmp)(const void *item, const void *key);  /* 0 if item has key */
+} gmbdll_Index;
+
 /* Linked list structure */
 typedef struct gmbdll_List{
-    gmbdll_Node *head;
-    gmbdll_Node *tail;
+    gmbdll_Link head;
+    gmbdll_Link tail;
     size_t size;
     gmbdll_Pool *pool;
+    gmbdll_Index *index;  /* Optional hash index, NULL if none */
+    gmbdll_Magazine *mag;  /* Optional node cache, NULL = use pool directly */
+    /* Optional limits (gmbdll_list_set_quota), 0 = none */
+    size_t reserve;  /* Nodes guaranteed to this list */
+    size_t quota;  /* Most nodes this list may hold */
+    size_t charged;  /* Nodes held, counted only while a limit is set */
+#if GMB_DLLIST_HANDLES
+    uint32_t tag;  /* Owner tag of the nodes of this list, unique per process */
+#endif
+#if GMB_DLLIST_STATS
+    gmbdll_ListStats stats;
+#endif
 } gmbdll_List;
 
+/* Cursor over the nodes of a list, forward (head to tail) or reverse */
+typedef struct gmbdll_Iter {
+    const gmbdll_List *list;
+    gmbdll_Node *node;  /* Node returned by the next call, NULL at the end */
+    int reverse;
+} gmbdll_Iter;
+
 /* ================================
  * API
  * ================================ */
 
-/* Initialize pool object. Must be called before using the pool. */
+/* Initialize pool object. Must be called before using the pool.
+   Constant time: nodes are handed out from a bump pointer the first time
+   and only recycled nodes go on free_list, so untouched pool memory is
+   never written. */
 int gmbdll_pool_init(gmbdll_Pool *pool);
 
+/* Initialize pool object on a caller-supplied node array of any size.
+   The buffer must outlive the pool. With 16-bit links count must be
+   below 0xFFFF. */
+int gmbdll_pool_init_buffer(gmbdll_Pool *pool, gmbdll_Node *buffer, size_t count);
+
+/* Enable growth: when the pool is exhausted, a block of block_nodes nodes
+   is obtained from alloc_fn(size, ctx) and chained to the pool.
+   Blocks are released by gmbdll_pool_destroy() through free_fn(ptr, ctx).
+   Not available with index links or handles (returns -1): indices
+   address a single contiguous array. */
+int gmbdll_pool_set_growth(gmbdll_Pool *pool, size_t block_nodes,
+                           void *(*alloc_fn)(size_t size, void *ctx),
+                           void (*free_fn)(void *ptr, void *ctx), void *ctx);
+
+/* Release the blocks added by the growth policy. Lists using the pool
+   must not be used afterwards (re-init the pool first). */
+void gmbdll_pool_destroy(gmbdll_Pool *pool);
+
+/* Compact the pool: move the nodes of lists[0..count-1] to the front of
+   the node array, each list contiguous and in list order, so traversal
+   walks memory sequentially. lists must be every list holding nodes of
+   the pool, each listed once (checked in O(count^2)). Afterwards there is no free list: the nodes past the used
+   ones are never-used again and can be released with gmbdll_pool_trim().
+   Attached indexes are rebuilt. All node pointers (and inline payload
+   addresses) of the pool are invalidated, and with GMB_DLLIST_HANDLES
+   so are all handles. O(fresh nodes), no extra memory.
+   Not available with growth blocks or registered magazines.
+   Returns 0 on success, -1 on failure (pool unchanged). */
+int gmbdll_pool_compact(gmbdll_Pool *pool, gmbdll_List *const *lists, size_t count);
+
+/* Give the memory of the never-used tail of the node array back to the
+   operating system (whole pages, madvise MADV_DONTNEED where available),
+   e.g. after gmbdll_pool_compact(). The pool keeps its capacity: released
+   pages come back zeroed (or as mapped) when nodes are handed out again.
+   Returns the number of bytes released (0 if unsupported). */
+size_t gmbdll_pool_trim(gmbdll_Pool *pool);
+
+/* Register a magazine on pool. Each thread sharing the pool uses its own
+   magazine; every list that thread touches must be attached to it.
+   Nodes cached in one magazine are not visible to the others, so an
+   allocation can fail while other magazines still hold free nodes. */
+int gmbdll_magazine_init(gmbdll_Magazine *mag, gmbdll_Pool *pool);
+
+/* Return all cached nodes to the pool and unregister the magazine.
+   Lists attached to it must be detached or no longer used. */
+void gmbdll_magazine_destroy(gmbdll_Magazine *mag);
+
 /* Initialize list and associate with a pool */
 int gmbdll_list_init(gmbdll_List *list, gmbdll_Pool *pool);
 
+/* Allocate and free the nodes of list through mag (NULL = directly from
+   the pool, which is then not thread-safe). mag must belong to the list
+   pool. Returns 0 on success, -1 on invalid arguments. */
+int gmbdll_list_set_magazine(gmbdll_List *list, gmbdll_Magazine *mag);
+
+/* Limit the nodes of list: at most quota nodes (0 = no quota), and
+   reserve nodes kept for it in the pool (0 = none). Other lists'
+   allocations fail rather than eat into the unused part of a
+   reservation, so a runaway list cannot starve the others. Both are
+   enforced when a node is allocated; a quota below the current size
+   only stops growth. Reservations count against the current capacity
+   (growth blocks are only added when the pool is out of nodes) and are
+   not available with a magazine. Set 0, 0 before discarding a list
+   that holds a reservation. Splice and concat fail if dst would exceed
+   its quota; they and split_at also fail if the source list would get
+   back reserved nodes the pool has no free nodes for.
+   Returns 0 on success, -1 if reserve > quota or the pool cannot
+   cover the reservation. */
+int gmbdll_list_set_quota(gmbdll_List *list, size_t reserve, size_t quota);
+
 /* Return 1 if list empty, 0 otherwise */
 int gmbdll_list_is_empty(const gmbdll_List *list);
 
 /* Return current size */
 size_t gmbdll_list_size(const gmbdll_List *list);
 
+/* First / last node of the list, NULL if empty */
+gmbdll_Node *gmbdll_list_head(const gmbdll_List *list);
+
+gmbdll_Node *gmbdll_list_tail(const gmbdll_List *list);
+
+/* Neighbours of a node of this list, NULL at the ends */
+gmbdll_Node *gmbdll_node_next(const gmbdll_List *list, const gmbdll_Node *node);
+
+gmbdll_Node *gmbdll_node_prev(const gmbdll_List *list, const gmbdll_Node *node);
+
 /* Push element at the beginning of the list */
 int gmbdll_push_front(gmbdll_List *list, void *data);
 
@@ -85,6 +379,24 @@ void *gmbdll_pop_front(gmbdll_List *list);
 /* Pop element from the end of the list */
 void *gmbdll_pop_back(gmbdll_List *list);
 
+/* Start a forward (head to tail) / reverse (tail to head) iteration */
+void gmbdll_iter_begin(gmbdll_Iter *it, const gmbdll_List *list);
+
+void gmbdll_iter_rbegin(gmbdll_Iter *it, const gmbdll_List *list);
+
+/* Return the current node and advance, NULL at the end. The iterator has
+   already moved on, so the returned node may be removed from the list;
+   other changes to the list invalidate the iterator. */
+gmbdll_Node *gmbdll_iter_next(gmbdll_Iter *it);
+
+/* Call fn with arrays of up to GMB_DLLIST_BATCH element values, in list
+   order. While a batch is gathered the next node and every element are
+   prefetched, so fn finds them in cache. fn returns 0 to continue,
+   non-zero to stop; the list must not be modified from fn.
+   Returns the number of elements handed to fn. */
+size_t gmbdll_list_for_each_batch(const gmbdll_List *list,
+    int (*fn)(void *const *items, size_t count, void *ctx), void *ctx);
+
 /* Generic find: returns pointer to node or NULL.
    cmp callback: returns 0 if equal, non-zero otherwise.
    key is passed to cmp. */
@@ -92,18 +404,133 @@ gmbdll_Node *gmbdll_list_find(gmbdll_List *list, \
 int (*cmp)(const void *item, const void *key), const void *key); 
 
 /* Remove a node given its pointer. If data_out != NULL, store the data pointer there.
-   Returns 0 on success, -1 if node or list invalid. */
+   Returns 0 on success, -1 if node or list invalid. With GMB_DLLIST_HANDLES
+   a node the list does not own (freed, or in another list) is rejected. */
 int gmbdll_list_remove_node(gmbdll_List *list, gmbdll_Node *node, void **data_out);
 
+/* Element held by a node: data, or the inline payload address for nodes
+   filled by the *_copy functions. find, sort, insert_sorted and the hash
+   index pass this to the callbacks. */
+void *gmbdll_node_value(const gmbdll_Node *node);
+
+#if GMB_DLLIST_PAYLOAD_SIZE > 0
+/* Copy size bytes (<= GMB_DLLIST_PAYLOAD_SIZE) from value into a new
+   inline node at the front / back. No allocation besides the pool node;
+   gmbdll_list_clear() skips free_func for inline nodes.
+   Returns 0 on success, -1 on failure. */
+int gmbdll_push_front_copy(gmbdll_List *list, const void *value, size_t size);
+
+int gmbdll_push_back_copy(gmbdll_List *list, const void *value, size_t size);
+
+/* Copy size bytes of the first / last element into out and remove it.
+   Returns 0 on success, -1 if empty. */
+int gmbdll_pop_front_copy(gmbdll_List *list, void *out, size_t size);
+
+int gmbdll_pop_back_copy(gmbdll_List *list, void *out, size_t size);
+#endif
+
+/* Move a node of the list to the front (unlink + relink, the node stays
+   allocated, so handles to it remain valid). O(1). */
+int gmbdll_list_move_to_front(gmbdll_List *list, gmbdll_Node *node);
+
 /* Clear list. If free_func != NULL, it is called for each data pointer.
    This frees all nodes back to the pool and resets list to empty. */
 void gmbdll_list_clear(gmbdll_List *list, void (*free_func)(void *));
 
-/* Optional: expose pool statistics */
+/* Push n data pointers at the end of the list, in array order.
+   Returns the number pushed (< n only if the pool ran out). */
+size_t gmbdll_push_back_n(gmbdll_List *list, void *const *items, size_t n);
+
+/* Pop up to n data pointers from the beginning of the list into out[].
+   The nodes go back to the pool in one step. Returns the number popped. */
+size_t gmbdll_pop_front_n(gmbdll_List *list, void **out, size_t n);
+
+/* Move all nodes of src before pos in dst (pos NULL = at the end).
+   Both lists must share the same pool. O(1).
+   Returns 0 on success, -1 on invalid arguments. */
+int gmbdll_list_splice(gmbdll_List *dst, gmbdll_Node *pos, gmbdll_List *src);
+
+/* Move all nodes of src to the end of dst (same pool). O(1). */
+int gmbdll_list_concat(gmbdll_List *dst, gmbdll_List *src);
+
+/* Move node and all nodes after it into out, which is re-initialized on
+   the same pool and magazine. out must be an initialized, empty list
+   without index, quota or reservation. Relinking is O(1); the moved part
+   is walked once to count it. Returns 0 on success, -1 on invalid
+   arguments. */
+int gmbdll_list_split_at(gmbdll_List *list, gmbdll_Node *node, gmbdll_List *out);
+
+/* Sort the list in place (stable bottom-up merge sort, no allocation).
+   cmp(a, b) follows the gmbdll_list_find convention but must order:
+   < 0 if a sorts before b, 0 if equal, > 0 otherwise. */
+void gmbdll_list_sort(gmbdll_List *list, int (*cmp)(const void *item, const void *key));
+
+/* Insert data into a list sorted by cmp, after any equal elements.
+   hint (optional) is a node of the list close to the insertion point,
+   e.g. the node returned by the previous call: the search starts there
+   and walks forward or backward. Without a hint, appends are O(1) and
+   other positions are found by scanning from the head.
+   Returns the new node, or NULL on failure (pool exhausted). */
+gmbdll_Node *gmbdll_list_insert_sorted(gmbdll_List *list, void *data,
+    int (*cmp)(const void *item, const void *key), gmbdll_Node *hint);
+
+/* Initialize a hash index on a caller buffer of nslots slots (power of
+   two, at least 2). Size it at about twice the expected number of nodes:
+   inserts fail once only one empty slot would remain.
+   key_of(data) extracts the key of an element (NULL = data itself),
+   hash(key) hashes it, cmp(data, key) returns 0 when data has key. */
+int gmbdll_index_init(gmbdll_Index *index, gmbdll_IndexSlot *slots, size_t nslots,
+                      const void *(*key_of)(const void *data),
+                      size_t (*hash)(const void *key),
+                      int (*cmp)(const void *item, const void *key));
+
+/* Attach index to list (NULL detaches). Nodes already in the list are
+   indexed. From then on every push, pop, remove, insert and clear keeps
+   the index in sync; a push fails if the index is full.
+   Splice, concat and split refuse lists that have an index.
+   Returns 0 on success, -1 on failure (index too small). */
+int gmbdll_list_attach_index(gmbdll_List *list, gmbdll_Index *index);
+
+/* O(1) lookup through the attached index. Returns node or NULL. */
+gmbdll_Node *gmbdll_list_find_key(gmbdll_List *list, const void *key);
+
+/* O(1) find + remove through the attached index. If data_out != NULL,
+   store the data pointer there. Returns 0 on success, -1 if not found. */
+int gmbdll_list_remove_key(gmbdll_List *list, const void *key, void **data_out);
+
+/* Optional: expose pool statistics. used counts the nodes held by lists;
+   nodes cached in magazines are not in use. */
 size_t gmbdll_pool_capacity(const gmbdll_Pool *pool);
 
 size_t gmbdll_pool_used(const gmbdll_Pool *pool);
 
+#if GMB_DLLIST_HANDLES
+/* Handle of a node of list (a never-valid, zeroed handle if list does
+   not own node) */
+gmbdll_Handle gmbdll_node_handle(const gmbdll_List *list, const gmbdll_Node *node);
+
+/* O(1) check + lookup: the node of handle if it is still the same
+   allocation and owned by list, NULL otherwise. */
+gmbdll_Node *gmbdll_handle_node(const gmbdll_List *list, gmbdll_Handle handle);
+
+/* O(1) checked remove. If data_out != NULL, store the data pointer there.
+   Returns 0 on success, -1 if the handle is stale or not of this list. */
+int gmbdll_list_remove_handle(gmbdll_List *list, gmbdll_Handle handle, void **data_out);
+#endif
+
+#if GMB_DLLIST_STATS
+/* Zero the counters (peaks restart from the current used / size) */
+void gmbdll_pool_stats_reset(gmbdll_Pool *pool);
+
+void gmbdll_list_stats_reset(gmbdll_List *list);
+
+/* Write the counters as one JSON object and a newline (JSON lines),
+   tagged with name. Returns 0 on success, -1 on failure. */
+int gmbdll_pool_stats_json(const gmbdll_Pool *pool, const char *name, FILE *out);
+
+int gmbdll_list_stats_json(const gmbdll_List *list, const char *name, FILE *out);
+#endif
+
 /* Debug: print list of integers (for testing only) */
 void gmbdll_print_int(const gmbdll_List *list);
 
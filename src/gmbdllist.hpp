@@ -0,0 +1,341 @@
+/*====================================
+ * File: gmbdllist.hpp
+ * Header-only C++ counterpart of gmbdllist: a fixed-capacity doubly
+ * linked list storing T by value in an in-object node pool.
+ *
+ * Comparators and destructors are template functors, so find/clear/sort
+ * inline; iterators are bidirectional and work with <algorithm>.
+ * No dynamic allocation and no exceptions of its own: operations that
+ * need a node report pool exhaustion through their return value.
+ * ===================================*/
+
+#ifndef GMBDLLIST_HPP
+#define GMBDLLIST_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace gmbdll {
+
+template <typename T, std::size_t Capacity>
+class List {
+    static_assert(Capacity > 0, "gmbdll::List needs at least one node");
+
+    /* Pool node: links plus raw storage for one T */
+    struct Node {
+        Node *next;
+        Node *prev;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() noexcept { return std::launder(reinterpret_cast<T *>(storage)); }
+        const T *value() const noexcept {
+            return std::launder(reinterpret_cast<const T *>(storage));
+        }
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+
+    /* Bidirectional iterator; end() is a null node that still knows its
+       list so that --end() reaches the tail. */
+    template <bool Const>
+    class Iter {
+        using NodePtr = std::conditional_t<Const, const Node *, Node *>;
+        using ListPtr = std::conditional_t<Const, const List *, List *>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        Iter() noexcept = default;
+        Iter(NodePtr node, ListPtr list) noexcept : node_(node), list_(list) {}
+        /* iterator -> const_iterator */
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iter(const Iter<false> &other) noexcept : node_(other.node_), list_(other.list_) {}
+
+        reference operator*() const noexcept { return *node_->value(); }
+        pointer operator->() const noexcept { return node_->value(); }
+
+        Iter &operator++() noexcept { node_ = node_->next; return *this; }
+        Iter operator++(int) noexcept { Iter tmp = *this; ++*this; return tmp; }
+        Iter &operator--() noexcept { node_ = node_ ? node_->prev : list_->tail_; return *this; }
+        Iter operator--(int) noexcept { Iter tmp = *this; --*this; return tmp; }
+
+        friend bool operator==(const Iter &a, const Iter &b) noexcept { return a.node_ == b.node_; }
+        friend bool operator!=(const Iter &a, const Iter &b) noexcept { return a.node_ != b.node_; }
+
+    private:
+        friend class List;
+        NodePtr node_ = nullptr;
+        ListPtr list_ = nullptr;
+    };
+
+    using iterator = Iter<false>;
+    using const_iterator = Iter<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    List() noexcept = default;
+
+    List(const List &other) noexcept(std::is_nothrow_copy_constructible<T>::value) {
+        for (const T &v : other) emplace_back(v);
+    }
+
+    /* Nodes live inside the object, so moving moves the elements */
+    List(List &&other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        for (T &v : other) emplace_back(std::move(v));
+        other.clear();
+    }
+
+    List &operator=(const List &other) {
+        if (this != &other) {
+            clear();
+            for (const T &v : other) emplace_back(v);
+        }
+        return *this;
+    }
+
+    List &operator=(List &&other) {
+        if (this != &other) {
+            clear();
+            for (T &v : other) emplace_back(std::move(v));
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~List() { clear(); }
+
+    /* ---- capacity ---- */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    bool full() const noexcept { return used_ == Capacity; }
+    static constexpr size_type capacity() noexcept { return Capacity; }
+
+    /* ---- element access (list must not be empty) ---- */
+    T &front() noexcept { return *head_->value(); }
+    const T &front() const noexcept { return *head_->value(); }
+    T &back() noexcept { return *tail_->value(); }
+    const T &back() const noexcept { return *tail_->value(); }
+
+    /* ---- iterators ---- */
+    iterator begin() noexcept { return iterator(head_, this); }
+    iterator end() noexcept { return iterator(nullptr, this); }
+    const_iterator begin() const noexcept { return const_iterator(head_, this); }
+    const_iterator end() const noexcept { return const_iterator(nullptr, this); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /* ---- insertion: return a pointer to the new element, or nullptr if
+       the pool is exhausted (nothing is constructed then) ---- */
+    template <typename... Args>
+    T *emplace_front(Args &&...args) { return emplace_before(head_, std::forward<Args>(args)...); }
+
+    template <typename... Args>
+    T *emplace_back(Args &&...args) { return emplace_before(nullptr, std::forward<Args>(args)...); }
+
+    template <typename... Args>
+    T *emplace(const_iterator pos, Args &&...args) {
+        return emplace_before(const_cast<Node *>(pos.node_), std::forward<Args>(args)...);
+    }
+
+    bool push_front(const T &v) { return emplace_front(v) != nullptr; }
+    bool push_front(T &&v) { return emplace_front(std::move(v)) != nullptr; }
+    bool push_back(const T &v) { return emplace_back(v) != nullptr; }
+    bool push_back(T &&v) { return emplace_back(std::move(v)) != nullptr; }
+
+    /* ---- removal ---- */
+    void pop_front() noexcept { destroy(head_); }
+    void pop_back() noexcept { destroy(tail_); }
+
+    /* Move the first / last element into out. Returns false if empty. */
+    bool pop_front(T &out) {
+        if (!head_) return false;
+        out = std::move(*head_->value());
+        destroy(head_);
+        return true;
+    }
+
+    bool pop_back(T &out) {
+        if (!tail_) return false;
+        out = std::move(*tail_->value());
+        destroy(tail_);
+        return true;
+    }
+
+    /* Erase the element at pos, return the iterator following it. O(1). */
+    iterator erase(const_iterator pos) noexcept {
+        Node *node = const_cast<Node *>(pos.node_);
+        Node *next = node->next;
+        destroy(node);
+        return iterator(next, this);
+    }
+
+    /* Destroy every element */
+    void clear() noexcept { clear([](T &) noexcept {}); }
+
+    /* Call on_each(element) before destroying each element */
+    template <typename Fn>
+    void clear(Fn &&on_each) {
+        Node *cur = head_;
+        while (cur) {
+            Node *next = cur->next;
+            on_each(*cur->value());
+            cur->value()->~T();
+            release(cur);
+            cur = next;
+        }
+        head_ = tail_ = nullptr;
+        size_ = 0;
+    }
+
+    /* ---- search ---- */
+    template <typename Pred>
+    iterator find_if(Pred pred) {
+        for (Node *cur = head_; cur; cur = cur->next) {
+            if (pred(*cur->value())) return iterator(cur, this);
+        }
+        return end();
+    }
+
+    template <typename Key, typename Eq = std::equal_to<>>
+    iterator find(const Key &key, Eq eq = Eq()) {
+        return find_if([&](const T &v) { return eq(v, key); });
+    }
+
+    /* ---- ordering ---- */
+
+    /* Stable in-place bottom-up merge sort, no allocation */
+    template <typename Less = std::less<>>
+    void sort(Less less = Less()) {
+        if (size_ < 2) return;
+        Node *head = head_;
+        Node *tail = nullptr;
+        for (size_type insize = 1;; insize *= 2) {
+            Node *p = head;
+            size_type nmerges = 0;
+            head = tail = nullptr;
+            while (p) {
+                Node *q = p;
+                size_type psize = 0, qsize = insize;
+                ++nmerges;
+                while (q && psize < insize) { ++psize; q = q->next; }
+                while (psize > 0 || (qsize > 0 && q)) {
+                    Node *e;
+                    if (psize == 0) { e = q; q = q->next; --qsize; }
+                    else if (qsize == 0 || !q || !less(*q->value(), *p->value())) {
+                        e = p; p = p->next; --psize;
+                    } else { e = q; q = q->next; --qsize; }
+                    if (tail) tail->next = e; else head = e;
+                    e->prev = tail;
+                    tail = e;
+                }
+                p = q;
+            }
+            tail->next = nullptr;
+            if (nmerges <= 1) break;
+        }
+        head_ = head;
+        tail_ = tail;
+    }
+
+    /* Move the element at pos to the front without touching the pool */
+    void move_to_front(const_iterator pos) noexcept {
+        Node *node = const_cast<Node *>(pos.node_);
+        if (node == head_) return;
+        unlink(node);
+        link_before(head_, node);
+    }
+
+    /* Pool statistics */
+    size_type pool_used() const noexcept { return used_; }
+
+private:
+    Node *acquire() noexcept {
+        Node *n;
+        if (free_) {
+            n = free_;
+            free_ = n->next;
+        } else if (fresh_ < Capacity) {
+            n = &nodes_[fresh_++];  /* never-used node (lazy pool init) */
+        } else {
+            return nullptr;
+        }
+        ++used_;
+        return n;
+    }
+
+    void release(Node *n) noexcept {
+        n->next = free_;
+        free_ = n;
+        --used_;
+    }
+
+    void link_before(Node *pos, Node *n) noexcept {
+        Node *before = pos ? pos->prev : tail_;
+        n->prev = before;
+        n->next = pos;
+        if (before) before->next = n; else head_ = n;
+        if (pos) pos->prev = n; else tail_ = n;
+        ++size_;
+    }
+
+    void unlink(Node *n) noexcept {
+        if (n->prev) n->prev->next = n->next; else head_ = n->next;
+        if (n->next) n->next->prev = n->prev; else tail_ = n->prev;
+        --size_;
+    }
+
+    template <typename... Args>
+    T *emplace_before(Node *pos, Args &&...args) {
+        Node *n = acquire();
+        if (!n) return nullptr;
+        if constexpr (std::is_nothrow_constructible<T, Args &&...>::value) {
+            ::new (static_cast<void *>(n->storage)) T(std::forward<Args>(args)...);
+        } else {
+            try {
+                ::new (static_cast<void *>(n->storage)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                release(n);
+                throw;
+            }
+        }
+        link_before(pos, n);
+        return n->value();
+    }
+
+    void destroy(Node *n) noexcept {
+        unlink(n);
+        n->value()->~T();
+        release(n);
+    }
+
+    Node nodes_[Capacity];
+    Node *free_ = nullptr;  /* recycled nodes */
+    size_type fresh_ = 0;   /* high-water mark in nodes_ */
+    size_type used_ = 0;
+    Node *head_ = nullptr;
+    Node *tail_ = nullptr;
+    size_type size_ = 0;
+};
+
+} // namespace gmbdll
+
+#endif /* GMBDLLIST_HPP */
@@ -0,0 +1,193 @@
+/*=================================================================
+ * gmbdlq.c
+ * Lock-free multi-producer/multi-consumer queue on a fixed pool.
+ *
+ * Michael & Scott non-blocking queue. Nodes come from a lock-free
+ * Treiber stack; every link (queue head/tail, node next, free-list
+ * top) is a 64-bit word holding a 32-bit node index plus a 32-bit
+ * tag bumped on each successful CAS, which protects against ABA.
+ * Nodes are never returned to the system, so reading a recycled
+ * node's link is harmless: the tag makes the following CAS fail.
+ *
+ * No dynamic allocation.
+ *=============================================================== */
+
+#include "gmbdlq.h"
+
+/* ---------------------------
+   Tagged index helpers
+   --------------------------- */
+
+#define QNIL            UINT32_C(0xFFFFFFFF)
+#define QIDX(v)         ((uint32_t)(v))
+#define QTAG(v)         ((uint32_t)((v) >> 32))
+#define QMAKE(idx, tag) (((uint64_t)(uint32_t)(tag) << 32) | (uint32_t)(idx))
+
+/* ---------------------------
+   Internal (static) functions
+   --------------------------- */
+
+/* Pop one node index from the free stack. Returns QNIL if exhausted. */
+static uint32_t qpool_alloc_node(gmbdll_QPool *pool) {
+    uint64_t top = atomic_load_explicit(&pool->free_list, memory_order_acquire);
+    for (;;) {
+        uint32_t idx = QIDX(top);
+        if (idx == QNIL) return QNIL;
+        uint64_t next = atomic_load_explicit(&pool->nodes[idx].next, memory_order_relaxed);
+        uint64_t desired = QMAKE(QIDX(next), QTAG(top) + 1);
+        if (atomic_compare_exchange_weak_explicit(&pool->free_list, &top, desired,
+                                                  memory_order_acquire, memory_order_acquire)) {
+            atomic_fetch_add_explicit(&pool->used, 1, memory_order_relaxed);
+            return idx;
+        }
+    }
+}
+
+/* Push node index back onto the free stack. */
+static void qpool_free_node(gmbdll_QPool *pool, uint32_t idx) {
+    gmbdll_QNode *n = &pool->nodes[idx];
+    uint64_t top = atomic_load_explicit(&pool->free_list, memory_order_relaxed);
+    for (;;) {
+        uint64_t old_next = atomic_load_explicit(&n->next, memory_order_relaxed);
+        atomic_store_explicit(&n->next, QMAKE(QIDX(top), QTAG(old_next) + 1),
+                              memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(&pool->free_list, &top,
+                                                  QMAKE(idx, QTAG(top) + 1),
+                                                  memory_order_release, memory_order_relaxed)) {
+            break;
+        }
+    }
+    atomic_fetch_sub_explicit(&pool->used, 1, memory_order_relaxed);
+}
+
+/* ---------------------------
+   Public API
+   (implementations for prototypes in gmbdlq.h)
+   --------------------------- */
+
+/* Initialize pool: link all nodes into the free stack. */
+int gmbdll_qpool_init(gmbdll_QPool *pool) {
+    if (!pool) return gmbdll_ERR;
+    pool->capacity = GMB_DLLIST_MAX_NODES;
+    atomic_init(&pool->used, 0);
+    uint32_t top = QNIL;
+    for (size_t i = 0; i < pool->capacity; ++i) {
+        atomic_init(&pool->nodes[i].data, NULL);
+        atomic_init(&pool->nodes[i].next, QMAKE(top, 0));
+        top = (uint32_t)i;
+    }
+    atomic_init(&pool->free_list, QMAKE(top, 0));
+    return gmbdll_OK;
+}
+
+/* Initialize queue with a dummy node taken from the pool. */
+int gmbdll_queue_init(gmbdll_Queue *queue, gmbdll_QPool *pool) {
+    if (!queue || !pool) return gmbdll_ERR;
+    uint32_t dummy = qpool_alloc_node(pool);
+    if (dummy == QNIL) return gmbdll_ERR;
+    gmbdll_QNode *n = &pool->nodes[dummy];
+    uint64_t old_next = atomic_load_explicit(&n->next, memory_order_relaxed);
+    atomic_store_explicit(&n->next, QMAKE(QNIL, QTAG(old_next) + 1), memory_order_relaxed);
+    queue->pool = pool;
+    atomic_init(&queue->head, QMAKE(dummy, 0));
+    atomic_init(&queue->tail, QMAKE(dummy, 0));
+    return gmbdll_OK;
+}
+
+/* Enqueue. Returns 0 on success, -1 on failure (pool exhausted). */
+int gmbdll_queue_push(gmbdll_Queue *queue, void *data) {
+    if (!queue || !queue->pool) return gmbdll_ERR;
+    gmbdll_QPool *pool = queue->pool;
+    uint32_t idx = qpool_alloc_node(pool);
+    if (idx == QNIL) return gmbdll_ERR;
+
+    gmbdll_QNode *node = &pool->nodes[idx];
+    atomic_store_explicit(&node->data, data, memory_order_relaxed);
+    uint64_t old_next = atomic_load_explicit(&node->next, memory_order_relaxed);
+    atomic_store_explicit(&node->next, QMAKE(QNIL, QTAG(old_next) + 1), memory_order_relaxed);
+
+    uint64_t tail;
+    for (;;) {
+        tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        gmbdll_QNode *last = &pool->nodes[QIDX(tail)];
+        uint64_t next = atomic_load_explicit(&last->next, memory_order_acquire);
+        if (tail != atomic_load_explicit(&queue->tail, memory_order_acquire)) continue;
+
+        if (QIDX(next) == QNIL) {
+            /* tail is really the last node: try to link the new one */
+            if (atomic_compare_exchange_weak_explicit(&last->next, &next,
+                                                      QMAKE(idx, QTAG(next) + 1),
+                                                      memory_order_release, memory_order_relaxed)) {
+                break;
+            }
+        } else {
+            /* tail is lagging behind: help advance it */
+            atomic_compare_exchange_strong_explicit(&queue->tail, &tail,
+                                                    QMAKE(QIDX(next), QTAG(tail) + 1),
+                                                    memory_order_release, memory_order_relaxed);
+        }
+    }
+
+    /* swing tail to the inserted node (failure means someone helped) */
+    atomic_compare_exchange_strong_explicit(&queue->tail, &tail, QMAKE(idx, QTAG(tail) + 1),
+                                            memory_order_release, memory_order_relaxed);
+    return gmbdll_OK;
+}
+
+/* Dequeue. Returns 0 and stores data in *data_out, -1 if empty. */
+int gmbdll_queue_pop(gmbdll_Queue *queue, void **data_out) {
+    if (!queue || !queue->pool) return gmbdll_ERR;
+    gmbdll_QPool *pool = queue->pool;
+    uint64_t head;
+    void *data;
+
+    for (;;) {
+        head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        uint64_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        uint64_t next = atomic_load_explicit(&pool->nodes[QIDX(head)].next, memory_order_acquire);
+        if (head != atomic_load_explicit(&queue->head, memory_order_acquire)) continue;
+
+        if (QIDX(head) == QIDX(tail)) {
+            if (QIDX(next) == QNIL) return gmbdll_ERR; /* empty */
+            /* tail is lagging behind: help advance it */
+            atomic_compare_exchange_strong_explicit(&queue->tail, &tail,
+                                                    QMAKE(QIDX(next), QTAG(tail) + 1),
+                                                    memory_order_release, memory_order_relaxed);
+        } else {
+            /* read data before the CAS: afterwards the node may be recycled */
+            data = atomic_load_explicit(&pool->nodes[QIDX(next)].data, memory_order_relaxed);
+            if (atomic_compare_exchange_weak_explicit(&queue->head, &head,
+                                                      QMAKE(QIDX(next), QTAG(head) + 1),
+                                                      memory_order_acq_rel, memory_order_relaxed)) {
+                break;
+            }
+        }
+    }
+
+    /* old dummy goes back to the pool; next becomes the new dummy */
+    qpool_free_node(pool, QIDX(head));
+    if (data_out) *data_out = data;
+    return gmbdll_OK;
+}
+
+/* Return 1 if queue empty at the time of the call, 0 otherwise */
+int gmbdll_queue_is_empty(gmbdll_Queue *queue) {
+    if (!queue || !queue->pool) return 1;
+    uint64_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    uint64_t next = atomic_load_explicit(&queue->pool->nodes[QIDX(head)].next,
+                                         memory_order_acquire);
+    return QIDX(next) == QNIL;
+}
+
+/* Pool statistics */
+size_t gmbdll_qpool_capacity(const gmbdll_QPool *pool) {
+    if (!pool) return 0;
+    return pool->capacity;
+}
+
+size_t gmbdll_qpool_used(gmbdll_QPool *pool) {
+    if (!pool) return 0;
+    return atomic_load_explicit(&pool->used, memory_order_relaxed);
+}
+
+/* End of file */
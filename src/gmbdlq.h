@@ -0,0 +1,79 @@
+/*====================================
+ * File: gmbdlq.h
+ * Lock-free MPMC queue on a fixed node pool
+ * (Michael-Scott queue, tagged 32-bit indices)
+ * ===================================*/
+
+#ifndef GMBDLQ_H
+#define GMBDLQ_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "gmbdllist.h" /* GMB_DLLIST_MAX_NODES, return codes */
+
+/* ================================
+ * Configuration
+ * ================================ */
+
+/* Alignment used to keep head and tail on separate cache lines */
+#ifndef GMB_DLLIST_CACHE_LINE
+#define GMB_DLLIST_CACHE_LINE 64
+#endif
+
+/* ================================
+ * Data structures
+ * ================================ */
+
+/* Queue node. Links are tagged indices into the pool:
+   low 32 bits = node index, high 32 bits = modification tag (ABA guard). */
+typedef struct gmbdll_QNode {
+    _Atomic(void *) data;
+    _Atomic uint64_t next;
+} gmbdll_QNode;
+
+/* Thread-safe node pool: a lock-free (Treiber) stack of free nodes.
+   It can be shared by several queues. */
+typedef struct gmbdll_QPool {
+    gmbdll_QNode nodes[GMB_DLLIST_MAX_NODES];
+    _Alignas(GMB_DLLIST_CACHE_LINE) _Atomic uint64_t free_list; /* tagged top of stack */
+    _Atomic size_t used;  /* Number of nodes currently in use */
+    size_t capacity;      /* Total capacity of the pool */
+} gmbdll_QPool;
+
+/* Multi-producer / multi-consumer queue. Always holds one dummy node. */
+typedef struct gmbdll_Queue {
+    _Alignas(GMB_DLLIST_CACHE_LINE) _Atomic uint64_t head;
+    _Alignas(GMB_DLLIST_CACHE_LINE) _Atomic uint64_t tail;
+    _Alignas(GMB_DLLIST_CACHE_LINE) gmbdll_QPool *pool;
+} gmbdll_Queue;
+
+/* ================================
+ * API
+ * ================================ */
+
+/* Initialize pool object. Must be called before using the pool
+   and before any thread touches it. */
+int gmbdll_qpool_init(gmbdll_QPool *pool);
+
+/* Initialize queue and associate with a pool (takes one dummy node). */
+int gmbdll_queue_init(gmbdll_Queue *queue, gmbdll_QPool *pool);
+
+/* Enqueue at the tail. Safe from any thread.
+   Returns 0 on success, -1 on failure (pool exhausted). */
+int gmbdll_queue_push(gmbdll_Queue *queue, void *data);
+
+/* Dequeue from the head. Safe from any thread.
+   Returns 0 and stores the data pointer in *data_out, -1 if empty. */
+int gmbdll_queue_pop(gmbdll_Queue *queue, void **data_out);
+
+/* Return 1 if queue empty at the time of the call, 0 otherwise */
+int gmbdll_queue_is_empty(gmbdll_Queue *queue);
+
+/* Pool statistics (snapshot, may be stale under concurrency) */
+size_t gmbdll_qpool_capacity(const gmbdll_QPool *pool);
+
+size_t gmbdll_qpool_used(gmbdll_QPool *pool);
+
+#endif /* GMBDLQ_H */
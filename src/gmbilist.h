@@ -0,0 +1,81 @@
+/*====================================
+ * File: gmbilist.h
+ * Intrusive doubly-linked list: the links live inside user structs
+ * ===================================*/
+
+#ifndef GMBILIST_H
+#define GMBILIST_H
+
+#include <stddef.h>
+
+#include "gmbdllist.h" /* return codes */
+
+/* Get the struct that contains a link:
+   GMBDLL_CONTAINER_OF(link_ptr, struct my_item, link_member) */
+#define GMBDLL_CONTAINER_OF(ptr, type, member) \
+    ((type *)((char *)(ptr) - offsetof(type, member)))
+
+/* ================================
+ * Data structures
+ * ================================ */
+
+/* Link to embed in user structs. A struct can sit on several lists at
+   once by embedding one link per list. */
+typedef struct gmbdll_ILink {
+    struct gmbdll_ILink *next;
+    struct gmbdll_ILink *prev;
+} gmbdll_ILink;
+
+/* Intrusive list structure */
+typedef struct gmbdll_IList {
+    gmbdll_ILink *head;
+    gmbdll_ILink *tail;
+    size_t size;
+} gmbdll_IList;
+
+/* ================================
+ * API (same semantics as gmbdll_List, no pool, no allocation)
+ * ================================ */
+
+/* Initialize list */
+int gmbdll_ilist_init(gmbdll_IList *list);
+
+/* Return 1 if list empty, 0 otherwise */
+int gmbdll_ilist_is_empty(const gmbdll_IList *list);
+
+/* Return current size */
+size_t gmbdll_ilist_size(const gmbdll_IList *list);
+
+/* Link at the beginning / end. The link must not be on a list. */
+int gmbdll_ilist_push_front(gmbdll_IList *list, gmbdll_ILink *link);
+
+int gmbdll_ilist_push_back(gmbdll_IList *list, gmbdll_ILink *link);
+
+/* Unlink and return the first / last link, NULL if empty */
+gmbdll_ILink *gmbdll_ilist_pop_front(gmbdll_IList *list);
+
+gmbdll_ILink *gmbdll_ilist_pop_back(gmbdll_IList *list);
+
+/* Generic find: cmp(link, key) returns 0 on match. */
+gmbdll_ILink *gmbdll_ilist_find(gmbdll_IList *list,
+    int (*cmp)(const gmbdll_ILink *item, const void *key), const void *key);
+
+/* Unlink a link of this list (membership is not verified). */
+int gmbdll_ilist_remove(gmbdll_IList *list, gmbdll_ILink *link);
+
+/* Move all links of src before pos in dst (pos NULL = at the end). O(1). */
+int gmbdll_ilist_splice(gmbdll_IList *dst, gmbdll_ILink *pos, gmbdll_IList *src);
+
+/* Move all links of src to the end of dst. O(1). */
+int gmbdll_ilist_concat(gmbdll_IList *dst, gmbdll_IList *src);
+
+/* Move link and all links after it into out, which must be an
+   initialized, empty list. Relinking is O(1); the moved part is walked
+   once to count it. Returns 0 on success, -1 on invalid arguments. */
+int gmbdll_ilist_split_at(gmbdll_IList *list, gmbdll_ILink *link, gmbdll_IList *out);
+
+/* Unlink everything. If release != NULL, it is called for each link
+   after it has been unlinked (it may free the containing struct). */
+void gmbdll_ilist_clear(gmbdll_IList *list, void (*release)(gmbdll_ILink *link));
+
+#endif /* GMBILIST_H */
@@ -0,0 +1,128 @@
+/*=================================================================
+ * gmblru.c
+ * Bounded LRU cache built on the pooled doubly-linked list.
+ *
+ * Recency order lives in a gmbdll_List (head = most recent), lookup in
+ * an attached gmbdll_Index. A hit relinks the node to the front without
+ * going through the pool; only evictions and removals free nodes.
+ *
+ * No dynamic allocation.
+ *=============================================================== */
+
+#include "gmblru.h"
+
+/* ---------------------------
+   Public API
+   (implementations for prototypes in gmblru.h)
+   --------------------------- */
+
+/* Initialize cache on pool and index slots. */
+int gmbdll_lru_init(gmbdll_Lru *lru, gmbdll_Pool *pool,
+                    gmbdll_IndexSlot *slots, size_t nslots,
+                    const void *(*key_of)(const void *data),
+                    size_t (*hash)(const void *key),
+                    int (*cmp)(const void *item, const void *key),
+                    void (*on_evict)(void *data, void *ctx), void *ctx) {
+    if (!lru || !pool || nslots == 0) return gmbdll_ERR;
+    /* validate everything before touching lru (or the slots) */
+    size_t capacity = gmbdll_pool_capacity(pool);
+    if (capacity > nslots - 1) capacity = nslots - 1;
+    if (capacity == 0) return gmbdll_ERR;
+    if (gmbdll_index_init(&lru->index, slots, nslots, key_of, hash, cmp) != gmbdll_OK) {
+        return gmbdll_ERR;
+    }
+    gmbdll_list_init(&lru->list, pool);
+    gmbdll_list_attach_index(&lru->list, &lru->index);
+    lru->capacity = capacity;
+    lru->on_evict = on_evict;
+    lru->ctx = ctx;
+    lru->hits = 0;
+    lru->misses = 0;
+    lru->evictions = 0;
+    return gmbdll_OK;
+}
+
+/* Look up key and mark it most recent on a hit. */
+void *gmbdll_lru_get(gmbdll_Lru *lru, const void *key) {
+    if (!lru) return NULL;
+    gmbdll_Node *node = gmbdll_list_find_key(&lru->list, key);
+    if (!node) {
+        lru->misses++;
+        return NULL;
+    }
+    lru->hits++;
+    gmbdll_list_move_to_front(&lru->list, node);
+    return node->data;
+}
+
+/* Insert or replace data as most recent entry. */
+int gmbdll_lru_put(gmbdll_Lru *lru, void *data, void **replaced) {
+    if (!lru) return gmbdll_ERR;
+    const gmbdll_Index *index = &lru->index;
+    const void *key = index->key_of ? index->key_of(data) : data;
+
+    gmbdll_Node *node = gmbdll_list_find_key(&lru->list, key);
+    if (node) {
+        /* same key: same hash, so the index slot stays valid */
+        if (replaced) *replaced = node->data;
+        node->data = data;
+        gmbdll_list_move_to_front(&lru->list, node);
+        return gmbdll_OK;
+    }
+
+    if (replaced) *replaced = NULL;
+    if (gmbdll_list_size(&lru->list) >= lru->capacity) gmbdll_lru_evict(lru);
+    while (gmbdll_push_front(&lru->list, data) != gmbdll_OK) {
+        /* pool shared with other users ran dry: make room ourselves */
+        if (gmbdll_lru_evict(lru) != gmbdll_OK) return gmbdll_ERR;
+    }
+    return gmbdll_OK;
+}
+
+/* Remove the entry with key without calling on_evict. */
+void *gmbdll_lru_remove(gmbdll_Lru *lru, const void *key) {
+    void *data = NULL;
+    if (!lru) return NULL;
+    if (gmbdll_list_remove_key(&lru->list, key, &data) != gmbdll_OK) return NULL;
+    return data;
+}
+
+/* Evict the least recently used entry. */
+int gmbdll_lru_evict(gmbdll_Lru *lru) {
+    if (!lru || gmbdll_list_is_empty(&lru->list)) return gmbdll_ERR;
+    void *data = gmbdll_pop_back(&lru->list);
+    lru->evictions++;
+    if (lru->on_evict) lru->on_evict(data, lru->ctx);
+    return gmbdll_OK;
+}
+
+/* Evict every entry. */
+void gmbdll_lru_clear(gmbdll_Lru *lru) {
+    if (!lru) return;
+    while (gmbdll_lru_evict(lru) == gmbdll_OK) {
+    }
+}
+
+/* Current number of entries */
+size_t gmbdll_lru_size(const gmbdll_Lru *lru) {
+    if (!lru) return 0;
+    return gmbdll_list_size(&lru->list);
+}
+
+/* Statistics */
+size_t gmbdll_lru_hits(const gmbdll_Lru *lru) {
+    if (!lru) return 0;
+    return lru->hits;
+}
+
+size_t gmbdll_lru_misses(const gmbdll_Lru *lru) {
+    if (!lru) return 0;
+    return lru->misses;
+}
+
+size_t gmbdll_lru_evictions(const gmbdll_Lru *lru) {
+    if (!lru) return 0;
+    return lru->evictions;
+}
+
+/* End of file */
@@ -0,0 +1,75 @@
+/*====================================
+ * File: gmblru.h
+ * Bounded LRU cache on gmbdll_List + gmbdll_Index
+ * ===================================*/
+
+#ifndef GMBLRU_H
+#define GMBLRU_H
+
+#include <stddef.h>
+
+#include "gmbdllist.h"
+
+/* ================================
+ * Data structures
+ * ================================ */
+
+/* LRU cache. Entries are user data pointers carrying their own key
+   (see key_of). The list keeps the most recently used entry at the head;
+   the attached hash index gives O(1) lookup. */
+typedef struct gmbdll_Lru {
+    gmbdll_List list;
+    gmbdll_Index index;
+    size_t capacity;  /* Maximum number of entries */
+    void (*on_evict)(void *data, void *ctx);  /* Optional eviction callback */
+    void *ctx;
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+} gmbdll_Lru;
+
+/* ================================
+ * API
+ * ================================ */
+
+/* Initialize cache. Capacity is the pool capacity at this point, bounded
+   by the index (nslots - 1); nslots must be a power of two, about twice
+   the capacity. key_of/hash/cmp follow gmbdll_index_init.
+   on_evict(data, ctx) is called for every entry the cache drops. */
+int gmbdll_lru_init(gmbdll_Lru *lru, gmbdll_Pool *pool,
+                    gmbdll_IndexSlot *slots, size_t nslots,
+                    const void *(*key_of)(const void *data),
+                    size_t (*hash)(const void *key),
+                    int (*cmp)(const void *item, const void *key),
+                    void (*on_evict)(void *data, void *ctx), void *ctx);
+
+/* Look up key. On a hit the entry becomes most recent and its data is
+   returned; on a miss NULL is returned. Updates hit/miss counters. */
+void *gmbdll_lru_get(gmbdll_Lru *lru, const void *key);
+
+/* Insert data as most recent entry, evicting the least recent one when
+   the cache is full. If an entry with the same key exists it is replaced
+   and its old data stored in *replaced (if not NULL), without eviction
+   callback. Returns 0 on success, -1 on failure. */
+int gmbdll_lru_put(gmbdll_Lru *lru, void *data, void **replaced);
+
+/* Remove the entry with key, returning its data (no callback), or NULL. */
+void *gmbdll_lru_remove(gmbdll_Lru *lru, const void *key);
+
+/* Evict the least recently used entry. Returns 0, or -1 if empty. */
+int gmbdll_lru_evict(gmbdll_Lru *lru);
+
+/* Evict every entry (calls on_evict for each). */
+void gmbdll_lru_clear(gmbdll_Lru *lru);
+
+/* Current number of entries */
+size_t gmbdll_lru_size(const gmbdll_Lru *lru);
+
+/* Statistics */
+size_t gmbdll_lru_hits(const gmbdll_Lru *lru);
+
+size_t gmbdll_lru_misses(const gmbdll_Lru *lru);
+
+size_t gmbdll_lru_evictions(const gmbdll_Lru *lru);
+
+#endif /* GMBLRU_H */
@@ -0,0 +1,222 @@
+/*=================================================================
+ * gmbskip.c
+ * Skip list ordered set on a fixed tower pool.
+ *
+ * Towers are variable-length (header + height links) and carved from
+ * a caller buffer, so the container never calls malloc. Heights follow
+ * a geometric distribution with p = 1/4: 1.33 links per element on
+ * average and about log4(n) levels to descend.
+ *=============================================================== */
+
+#include "gmbskip.h"
+
+#define SKIP_KEY(sl, data) \
+    ((sl)->key_of ? (sl)->key_of(data) : (const void *)(data))
+
+/* ---------------------------
+   Internal (static) functions
+   --------------------------- */
+
+/* Bytes of a tower of cap levels, rounded up for pointer alignment */
+static size_t tower_size(size_t cap) {
+    size_t bytes = sizeof(gmbdll_SkipNode) + cap * sizeof(gmbdll_SkipNode *);
+    return (bytes + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+}
+
+/* Take a tower of height from the pool: a recycled tower of exactly
+   that cap, else fresh buffer memory, else the lowest taller recycled
+   one. Returns NULL if exhausted. */
+static gmbdll_SkipNode *pool_alloc_tower(gmbdll_SkipPool *pool, int height) {
+    gmbdll_SkipNode *n = pool->free_lists[height - 1];
+    if (n) {
+        pool->free_lists[height - 1] = n->next[0];
+    } else if (pool->size - pool->bump >= tower_size((size_t)height)) {
+        n = (gmbdll_SkipNode *)(pool->buf + pool->bump);
+        pool->bump += tower_size((size_t)height);
+        n->cap = (unsigned char)height;
+    } else {
+        for (int h = height; h < GMB_DLLIST_SKIP_MAX_LEVEL && !n; ++h) {
+            n = pool->free_lists[h];
+            if (n) pool->free_lists[h] = n->next[0];
+        }
+        if (!n) return NULL;
+    }
+    n->height = (unsigned char)height;
+    pool->used++;
+    return n;
+}
+
+/* Put a tower back on the free list of its cap. */
+static void pool_free_tower(gmbdll_SkipPool *pool, gmbdll_SkipNode *n) {
+    n->data = NULL;
+    n->next[0] = pool->free_lists[n->cap - 1];
+    pool->free_lists[n->cap - 1] = n;
+    pool->used--;
+}
+
+/* Geometric tower height, p = 1/4 (xorshift32 generator). */
+static int random_height(gmbdll_SkipList *sl) {
+    uint32_t x = sl->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sl->rng = x;
+    int h = 1;
+    while (h < GMB_DLLIST_SKIP_MAX_LEVEL && (x & 3) == 0) {
+        h++;
+        x >>= 2;
+    }
+    return h;
+}
+
+/* Descend to the last node before key on each level. update[i] is the
+   link to patch on level i (&head[i] or &node->next[i]).
+   Returns the first node not sorting before key (or NULL). */
+static gmbdll_SkipNode *skip_search(const gmbdll_SkipList *sl, const void *key,
+                                    gmbdll_SkipNode **update[]) {
+    gmbdll_SkipNode *const *links = sl->head;
+    for (int i = sl->level - 1; i >= 0; --i) {
+        gmbdll_SkipNode *n;
+        while ((n = links[i]) != NULL && sl->cmp(n->data, key) < 0) links = n->next;
+        if (update) update[i] = (gmbdll_SkipNode **)&links[i];
+    }
+    return sl->level ? links[0] : NULL;
+}
+
+/* ---------------------------
+   Public API
+   (implementations for prototypes in gmbskip.h)
+   --------------------------- */
+
+/* Initialize tower pool on a caller buffer. */
+int gmbdll_skippool_init(gmbdll_SkipPool *pool, void *buffer, size_t size) {
+    if (!pool || !buffer || ((uintptr_t)buffer % sizeof(void *)) != 0) return gmbdll_ERR;
+    pool->buf = (unsigned char *)buffer;
+    pool->size = size;
+    pool->bump = 0;
+    for (int i = 0; i < GMB_DLLIST_SKIP_MAX_LEVEL; ++i) pool->free_lists[i] = NULL;
+    pool->used = 0;
+    return gmbdll_OK;
+}
+
+size_t gmbdll_skippool_used(const gmbdll_SkipPool *pool) {
+    if (!pool) return 0;
+    return pool->used;
+}
+
+/* Initialize an empty skip list. */
+int gmbdll_skip_init(gmbdll_SkipList *sl, gmbdll_SkipPool *pool,
+                     const void *(*key_of)(const void *data),
+                     int (*cmp)(const void *item, const void *key), uint32_t seed) {
+    if (!sl || !pool || !cmp) return gmbdll_ERR;
+    for (int i = 0; i < GMB_DLLIST_SKIP_MAX_LEVEL; ++i) sl->head[i] = NULL;
+    sl->level = 0;
+    sl->size = 0;
+    sl->rng = seed ? seed : 0x9E3779B9u; /* xorshift state must not be 0 */
+    sl->pool = pool;
+    sl->key_of = key_of;
+    sl->cmp = cmp;
+    return gmbdll_OK;
+}
+
+/* Return current size */
+size_t gmbdll_skip_size(const gmbdll_SkipList *sl) {
+    if (!sl) return 0;
+    return sl->size;
+}
+
+/* Insert data in key order. */
+int gmbdll_skip_insert(gmbdll_SkipList *sl, void *data, void **existing) {
+    if (existing) *existing = NULL;
+    if (!sl) return gmbdll_ERR;
+    const void *key = SKIP_KEY(sl, data);
+    gmbdll_SkipNode **update[GMB_DLLIST_SKIP_MAX_LEVEL];
+    gmbdll_SkipNode *n = skip_search(sl, key, update);
+    if (n && sl->cmp(n->data, key) == 0) {
+        if (existing) *existing = n->data;
+        return gmbdll_ERR; /* keys are unique */
+    }
+
+    int height = random_height(sl);
+    gmbdll_SkipNode *node = pool_alloc_tower(sl->pool, height);
+    if (!node) return gmbdll_ERR;
+    node->data = data;
+    while (sl->level < height) {
+        update[sl->level] = &sl->head[sl->level];
+        sl->level++;
+    }
+    for (int i = 0; i < height; ++i) {
+        node->next[i] = *update[i];
+        *update[i] = node;
+    }
+    sl->size++;
+    return gmbdll_OK;
+}
+
+/* Remove the element with key. */
+int gmbdll_skip_erase(gmbdll_SkipList *sl, const void *key, void **data_out) {
+    if (!sl) return gmbdll_ERR;
+    gmbdll_SkipNode **update[GMB_DLLIST_SKIP_MAX_LEVEL];
+    gmbdll_SkipNode *n = skip_search(sl, key, update);
+    if (!n || sl->cmp(n->data, key) != 0) return gmbdll_ERR;
+
+    for (int i = 0; i < n->height; ++i) *update[i] = n->next[i];
+    while (sl->level > 0 && sl->head[sl->level - 1] == NULL) sl->level--;
+    if (data_out) *data_out = n->data;
+    pool_free_tower(sl->pool, n);
+    sl->size--;
+    return gmbdll_OK;
+}
+
+/* Node holding key, or NULL */
+gmbdll_SkipNode *gmbdll_skip_find(const gmbdll_SkipList *sl, const void *key) {
+    if (!sl) return NULL;
+    gmbdll_SkipNode *n = skip_search(sl, key, NULL);
+    return (n && sl->cmp(n->data, key) == 0) ? n : NULL;
+}
+
+/* First node not sorting before key */
+gmbdll_SkipNode *gmbdll_skip_lower_bound(const gmbdll_SkipList *sl, const void *key) {
+    if (!sl) return NULL;
+    return skip_search(sl, key, NULL);
+}
+
+gmbdll_SkipNode *gmbdll_skip_first(const gmbdll_SkipList *sl) {
+    if (!sl) return NULL;
+    return sl->head[0];
+}
+
+gmbdll_SkipNode *gmbdll_skip_next(const gmbdll_SkipNode *node) {
+    if (!node) return NULL;
+    return node->next[0];
+}
+
+/* Visit lo <= key < hi in order. */
+size_t gmbdll_skip_range(const gmbdll_SkipList *sl, const void *lo, const void *hi,
+                         int (*fn)(void *data, void *ctx), void *ctx) {
+    if (!sl || !fn) return 0;
+    size_t visited = 0;
+    gmbdll_SkipNode *n = lo ? skip_search(sl, lo, NULL) : sl->head[0];
+    for (; n && (!hi || sl->cmp(n->data, hi) < 0); n = n->next[0]) {
+        visited++;
+        if (fn(n->data, ctx) != 0) break;
+    }
+    return visited;
+}
+
+/* Remove all elements. */
+void gmbdll_skip_clear(gmbdll_SkipList *sl, void (*free_func)(void *)) {
+    if (!sl) return;
+    gmbdll_SkipNode *n = sl->head[0];
+    while (n) {
+        gmbdll_SkipNode *next = n->next[0];
+        if (free_func) free_func(n->data);
+        pool_free_tower(sl->pool, n);
+        n = next;
+    }
+    for (int i = 0; i < GMB_DLLIST_SKIP_MAX_LEVEL; ++i) sl->head[i] = NULL;
+    sl->level = 0;
+    sl->size = 0;
+}
+
+/* End of file */
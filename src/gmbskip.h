@@ -0,0 +1,116 @@
+/*====================================
+ * File: gmbskip.h
+ * Ordered set (skip list) with towers from a fixed pool
+ * ===================================*/
+
+#ifndef GMBSKIP_H
+#define GMBSKIP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gmbdllist.h" /* return codes */
+
+/* ================================
+ * Configuration
+ * ================================ */
+
+/* Maximum tower height. Levels are promoted with probability 1/4,
+   so 16 levels keep O(log n) search up to about 4^16 elements. */
+#ifndef GMB_DLLIST_SKIP_MAX_LEVEL
+#define GMB_DLLIST_SKIP_MAX_LEVEL 16
+#endif
+
+#if GMB_DLLIST_SKIP_MAX_LEVEL < 1 || GMB_DLLIST_SKIP_MAX_LEVEL > 255
+#error "GMB_DLLIST_SKIP_MAX_LEVEL must be between 1 and 255"
+#endif
+
+/* ================================
+ * Data structures
+ * ================================ */
+
+/* Tower: one element and its forward links, next[0] is the full
+   ordered chain. cap is the height the memory was carved for. */
+typedef struct gmbdll_SkipNode {
+    void *data;
+    unsigned char height;
+    unsigned char cap;
+    struct gmbdll_SkipNode *next[];
+} gmbdll_SkipNode;
+
+/* Tower pool on a caller byte buffer: never-used memory is handed out
+   by a bump offset, released towers wait on one free list per height
+   and are reused for towers of that height or lower. */
+typedef struct gmbdll_SkipPool {
+    unsigned char *buf;
+    size_t size;  /* Buffer bytes */
+    size_t bump;  /* Bytes handed out from the buffer */
+    gmbdll_SkipNode *free_lists[GMB_DLLIST_SKIP_MAX_LEVEL];  /* by cap - 1 */
+    size_t used;  /* Towers currently in use */
+} gmbdll_SkipPool;
+
+/* Skip list. Elements are ordered by key_of(data) (NULL = data itself)
+   through cmp(item, key), which returns < 0, 0 or > 0 as item sorts
+   before, equal to or after key. Keys are unique. */
+typedef struct gmbdll_SkipList {
+    gmbdll_SkipNode *head[GMB_DLLIST_SKIP_MAX_LEVEL];
+    int level;  /* Levels in use */
+    size_t size;
+    uint32_t rng;  /* Level generator state */
+    gmbdll_SkipPool *pool;
+    const void *(*key_of)(const void *data);
+    int (*cmp)(const void *item, const void *key);
+} gmbdll_SkipList;
+
+/* ================================
+ * API
+ * ================================ */
+
+/* Initialize pool on a caller buffer of size bytes (aligned for
+   pointers). Several skip lists may share one pool. */
+int gmbdll_skippool_init(gmbdll_SkipPool *pool, void *buffer, size_t size);
+
+/* Number of towers in use */
+size_t gmbdll_skippool_used(const gmbdll_SkipPool *pool);
+
+/* Initialize an empty skip list on pool. seed drives tower heights
+   (any value, 0 included). */
+int gmbdll_skip_init(gmbdll_SkipList *sl, gmbdll_SkipPool *pool,
+                     const void *(*key_of)(const void *data),
+                     int (*cmp)(const void *item, const void *key), uint32_t seed);
+
+/* Return current size */
+size_t gmbdll_skip_size(const gmbdll_SkipList *sl);
+
+/* Insert data in key order. Expected O(log n).
+   Returns 0 on success, -1 if the key is already present (its data is
+   stored in *existing when existing != NULL) or the pool is exhausted
+   (*existing set to NULL). */
+int gmbdll_skip_insert(gmbdll_SkipList *sl, void *data, void **existing);
+
+/* Remove the element with key. If data_out != NULL, store its data there.
+   Returns 0 on success, -1 if not found. */
+int gmbdll_skip_erase(gmbdll_SkipList *sl, const void *key, void **data_out);
+
+/* Node holding key, or NULL */
+gmbdll_SkipNode *gmbdll_skip_find(const gmbdll_SkipList *sl, const void *key);
+
+/* First node whose element does not sort before key, or NULL */
+gmbdll_SkipNode *gmbdll_skip_lower_bound(const gmbdll_SkipList *sl, const void *key);
+
+/* First node / following node in key order, NULL at the end */
+gmbdll_SkipNode *gmbdll_skip_first(const gmbdll_SkipList *sl);
+
+gmbdll_SkipNode *gmbdll_skip_next(const gmbdll_SkipNode *node);
+
+/* Call fn(data, ctx) for each element with lo <= key < hi, in order
+   (lo NULL = from the first, hi NULL = to the last). fn returns 0 to
+   continue, non-zero to stop. Returns the number of elements visited. */
+size_t gmbdll_skip_range(const gmbdll_SkipList *sl, const void *lo, const void *hi,
+                         int (*fn)(void *data, void *ctx), void *ctx);
+
+/* Remove all elements. If free_func != NULL, it is called for each
+   data pointer. Towers go back to the pool. */
+void gmbdll_skip_clear(gmbdll_SkipList *sl, void (*free_func)(void *));
+
+#endif /* GMBSKIP_H */
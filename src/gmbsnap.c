@@ -0,0 +1,252 @@
+/*=================================================================
+ * gmbsnap.c
+ * Snapshot a gmbdll_Pool and its lists to a file, reopen it with mmap.
+ *
+ * With index links a pool holds no absolute addresses: next/prev,
+ * free_list and list head/tail are indices into the node array. The
+ * array is therefore written verbatim and, on restore, the pool is
+ * simply pointed at the array inside the mapping. Only nodes below the
+ * bump counter are written; the never-used tail of the pool is left
+ * as a hole in the file, so it costs neither disk nor load time.
+ *
+ * POSIX (open/mmap). Pointer-link builds refuse to save or open.
+ *=============================================================== */
+
+#define _POSIX_C_SOURCE 200809L /* ftruncate, fsync */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gmbsnap.h"
+
+#define SNAP_MAGIC  0x534E4D47u  /* "GMNS" read as little endian */
+#define SNAP_ALIGN  4096u        /* node array offset alignment */
+
+/* ---------------------------
+   Internal (static) functions
+   --------------------------- */
+
+#if GMB_DLLIST_INDEX_LINKS
+
+/* 64-bit FNV-1a over 8-byte words (byte-wise for the tail). */
+static uint64_t snap_hash(uint64_t h, const void *buf, size_t len) {
+    const unsigned char *p = (const unsigned char *)buf;
+    for (; len >= 8; p += 8, len -= 8) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        h = (h ^ w) * 0x100000001B3ull;
+    }
+    for (; len > 0; ++p, --len) h = (h ^ *p) * 0x100000001B3ull;
+    return h;
+}
+
+#define SNAP_HASH_SEED 0xCBF29CE484222325ull
+
+/* Checksum of header (checksum field taken as 0) and list table. */
+static uint64_t snap_meta_checksum(const gmbdll_SnapHeader *header,
+                                   const gmbdll_SnapList *lists) {
+    gmbdll_SnapHeader copy = *header;
+    copy.checksum = 0;
+    uint64_t h = snap_hash(SNAP_HASH_SEED, &copy, sizeof(copy));
+    return snap_hash(h, lists, header->list_count * sizeof(gmbdll_SnapList));
+}
+
+/* Write all of buf. Returns 0 on success. */
+static int write_all(int fd, const void *buf, size_t len) {
+    const char *p = (const char *)buf;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n <= 0) return gmbdll_ERR;
+        p += n;
+        len -= (size_t)n;
+    }
+    return gmbdll_OK;
+}
+
+/* List table entry of list. */
+static gmbdll_SnapList snap_list_entry(const gmbdll_List *list) {
+    gmbdll_SnapList entry;
+    entry.head = list->head;
+    entry.tail = list->tail;
+    entry.size = list->size;
+    return entry;
+}
+
+/* File offset of the node array after the header and list table. */
+static size_t snap_nodes_offset(size_t list_count) {
+    size_t meta = sizeof(gmbdll_SnapHeader) + list_count * sizeof(gmbdll_SnapList);
+    return (meta + SNAP_ALIGN - 1) / SNAP_ALIGN * SNAP_ALIGN;
+}
+#endif
+
+/* ---------------------------
+   Public API
+   (implementations for prototypes in gmbsnap.h)
+   --------------------------- */
+
+/* Write pool and lists to path. */
+int gmbdll_snapshot_save(const char *path, const gmbdll_Pool *pool,
+                         const gmbdll_List *const *lists, size_t count) {
+#if GMB_DLLIST_INDEX_LINKS == 0
+    (void)path; (void)pool; (void)lists; (void)count;
+    return gmbdll_ERR; /* pointers would need fixups */
+#else
+    if (!path || !pool || (!lists && count) || count > UINT32_MAX) return gmbdll_ERR;
+    if (pool->blocks || pool->mags || pool->reserved) return gmbdll_ERR;
+    for (size_t i = 0; i < count; ++i) {
+        if (!lists[i] || lists[i]->pool != pool) return gmbdll_ERR;
+        if (lists[i]->quota || lists[i]->reserve) return gmbdll_ERR;
+    }
+
+    const gmbdll_Node *nodes = pool->buf ? pool->buf : pool->nodes;
+    gmbdll_SnapHeader header;
+    memset(&header, 0, sizeof(header)); /* no stray padding in the file */
+    header.magic = SNAP_MAGIC;
+    header.version = GMB_DLLIST_SNAP_VERSION;
+    header.link_bits = GMB_DLLIST_INDEX_LINKS;
+    header.payload_size = GMB_DLLIST_PAYLOAD_SIZE;
+    header.node_size = sizeof(gmbdll_Node);
+    header.list_count = (uint32_t)count;
+    header.handles = GMB_DLLIST_HANDLES;
+#if GMB_DLLIST_HANDLES
+    header.gen_floor = pool->gen_floor;
+#endif
+    header.capacity = pool->capacity;
+    header.fresh = pool->fresh;
+    header.used = pool->used;
+    header.free_list = pool->free_list;
+    header.nodes_offset = snap_nodes_offset(count);
+    header.nodes_checksum = snap_hash(SNAP_HASH_SEED, nodes, pool->fresh * sizeof(gmbdll_Node));
+    /* same value as snap_meta_checksum over the table written below */
+    uint64_t checksum = snap_hash(SNAP_HASH_SEED, &header, sizeof(header));
+    for (size_t i = 0; i < count; ++i) {
+        gmbdll_SnapList entry = snap_list_entry(lists[i]);
+        checksum = snap_hash(checksum, &entry, sizeof(entry));
+    }
+    header.checksum = checksum;
+
+    /* write next to the target, then atomically replace it */
+    char tmp[4096];
+    if ((size_t)snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= sizeof(tmp)) return gmbdll_ERR;
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return gmbdll_ERR;
+    off_t total = (off_t)(header.nodes_offset + header.capacity * sizeof(gmbdll_Node));
+    int rc = write_all(fd, &header, sizeof(header));
+    for (size_t i = 0; i < count && rc == gmbdll_OK; ++i) {
+        gmbdll_SnapList entry = snap_list_entry(lists[i]);
+        rc = write_all(fd, &entry, sizeof(entry));
+    }
+    if (rc == gmbdll_OK && lseek(fd, (off_t)header.nodes_offset, SEEK_SET) < 0) rc = gmbdll_ERR;
+    if (rc == gmbdll_OK) rc = write_all(fd, nodes, pool->fresh * sizeof(gmbdll_Node));
+    if (rc == gmbdll_OK && ftruncate(fd, total) != 0) rc = gmbdll_ERR; /* sparse tail */
+    if (rc == gmbdll_OK && fsync(fd) != 0) rc = gmbdll_ERR;
+    if (close(fd) != 0) rc = gmbdll_ERR;
+    if (rc == gmbdll_OK && rename(tmp, path) != 0) rc = gmbdll_ERR;
+    if (rc != gmbdll_OK) unlink(tmp);
+    return rc;
+#endif
+}
+
+/* Map a snapshot and validate it. */
+int gmbdll_snapshot_open(gmbdll_Snapshot *snap, const char *path, int flags) {
+    if (!snap || !path) return gmbdll_ERR;
+    snap->map = NULL;
+    snap->map_size = 0;
+    snap->header = NULL;
+#if GMB_DLLIST_INDEX_LINKS == 0
+    (void)flags;
+    return gmbdll_ERR;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return gmbdll_ERR;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(gmbdll_SnapHeader)) {
+        close(fd);
+        return gmbdll_ERR;
+    }
+    size_t size = (size_t)st.st_size;
+    /* private + writable: the restored pool keeps working copy-on-write */
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return gmbdll_ERR;
+
+    const gmbdll_SnapHeader *h = (const gmbdll_SnapHeader *)map;
+    const gmbdll_SnapList *table = (const gmbdll_SnapList *)(h + 1);
+    int ok = h->magic == SNAP_MAGIC &&
+             h->version == GMB_DLLIST_SNAP_VERSION &&
+             h->link_bits == GMB_DLLIST_INDEX_LINKS &&
+             h->payload_size == GMB_DLLIST_PAYLOAD_SIZE &&
+             h->handles == GMB_DLLIST_HANDLES &&
+             h->node_size == sizeof(gmbdll_Node) &&
+             h->nodes_offset == snap_nodes_offset(h->list_count) &&
+             h->capacity > 0 && h->capacity < (uint64_t)GMB_DLLIST_NIL &&
+             h->fresh <= h->capacity && h->used <= h->fresh &&
+             h->nodes_offset + h->capacity * sizeof(gmbdll_Node) == size;
+    if (ok) ok = snap_meta_checksum(h, table) == h->checksum;
+    if (ok && (flags & GMB_DLLIST_SNAP_VERIFY)) {
+        const unsigned char *nodes = (const unsigned char *)map + h->nodes_offset;
+        ok = snap_hash(SNAP_HASH_SEED, nodes, h->fresh * sizeof(gmbdll_Node)) == h->nodes_checksum;
+    }
+    if (!ok) {
+        munmap(map, size);
+        return gmbdll_ERR;
+    }
+    snap->map = map;
+    snap->map_size = size;
+    snap->header = h;
+    return gmbdll_OK;
+#endif
+}
+
+/* Number of lists stored in an open snapshot */
+size_t gmbdll_snapshot_list_count(const gmbdll_Snapshot *snap) {
+    if (!snap || !snap->header) return 0;
+    return snap->header->list_count;
+}
+
+/* Bind pool and lists to the mapped node array. */
+int gmbdll_snapshot_restore(gmbdll_Snapshot *snap, gmbdll_Pool *pool,
+                            gmbdll_List *lists, size_t count) {
+    if (!snap || !snap->header || !pool || (!lists && count)) return gmbdll_ERR;
+    const gmbdll_SnapHeader *h = snap->header;
+    if (count != h->list_count) return gmbdll_ERR;
+    gmbdll_Node *nodes = (gmbdll_Node *)((unsigned char *)snap->map + h->nodes_offset);
+    if (gmbdll_pool_init_buffer(pool, nodes, (size_t)h->capacity) != gmbdll_OK) return gmbdll_ERR;
+    pool->fresh = (size_t)h->fresh;
+    pool->used = (size_t)h->used;
+    pool->free_list = (gmbdll_Link)h->free_list;
+#if GMB_DLLIST_HANDLES
+    pool->gen_floor = h->gen_floor;
+#endif
+
+    const gmbdll_SnapList *table = (const gmbdll_SnapList *)(h + 1);
+    for (size_t i = 0; i < count; ++i) {
+        gmbdll_list_init(&lists[i], pool);
+        lists[i].head = (gmbdll_Link)table[i].head;
+        lists[i].tail = (gmbdll_Link)table[i].tail;
+        lists[i].size = (size_t)table[i].size;
+#if GMB_DLLIST_HANDLES
+        /* tags are per process: hand the nodes to the new list tag
+           (O(n), the only step that touches every restored node) */
+        for (gmbdll_Node *n = gmbdll_list_head(&lists[i]); n; n = gmbdll_node_next(&lists[i], n)) {
+            n->owner = lists[i].tag;
+        }
+#endif
+    }
+    return gmbdll_OK;
+}
+
+/* Unmap the snapshot. */
+void gmbdll_snapshot_close(gmbdll_Snapshot *snap) {
+    if (!snap || !snap->map) return;
+    munmap(snap->map, snap->map_size);
+    snap->map = NULL;
+    snap->map_size = 0;
+    snap->header = NULL;
+}
+
+/* End of file */
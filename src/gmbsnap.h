@@ -0,0 +1,104 @@
+/*====================================
+ * File: gmbsnap.h
+ * Persistent snapshots of a gmbdll_Pool and its lists,
+ * reopened with mmap and no per-node fixups (POSIX)
+ * ===================================*/
+
+#ifndef GMBSNAP_H
+#define GMBSNAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gmbdllist.h"
+
+/* ================================
+ * Configuration
+ * ================================ */
+
+/* File format version, bumped on any layout change */
+#define GMB_DLLIST_SNAP_VERSION 4
+
+/* gmbdll_snapshot_open flags */
+#define GMB_DLLIST_SNAP_VERIFY 1  /* also checksum the node array (O(n)) */
+
+/* ================================
+ * Data structures
+ * ================================ */
+
+/* File layout (native byte order):
+     gmbdll_SnapHeader
+     gmbdll_SnapList[list_count]
+     padding to nodes_offset (page aligned)
+     gmbdll_Node[capacity]  (only the first fresh nodes are written,
+                             the rest of the file is a sparse hole)
+   All links are node indices, so the node array is used in place. */
+typedef struct gmbdll_SnapHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t link_bits;  /* GMB_DLLIST_INDEX_LINKS */
+    uint32_t payload_size;  /* GMB_DLLIST_PAYLOAD_SIZE */
+    uint32_t node_size;  /* sizeof(gmbdll_Node) */
+    uint32_t list_count;
+    uint32_t handles;  /* GMB_DLLIST_HANDLES */
+    uint32_t gen_floor;  /* generation of never-used nodes (handles only) */
+    uint64_t capacity;  /* pool nodes */
+    uint64_t fresh;  /* nodes ever handed out (written to the file) */
+    uint64_t used;
+    uint64_t free_list;
+    uint64_t nodes_offset;  /* file offset of the node array */
+    uint64_t nodes_checksum;  /* over fresh nodes */
+    uint64_t checksum;  /* over header (this field 0) and list table */
+} gmbdll_SnapHeader;
+
+typedef struct gmbdll_SnapList {
+    uint64_t head;
+    uint64_t tail;
+    uint64_t size;
+} gmbdll_SnapList;
+
+/* An open snapshot: a private (copy-on-write) mapping of the file */
+typedef struct gmbdll_Snapshot {
+    void *map;
+    size_t map_size;
+    const gmbdll_SnapHeader *header;
+} gmbdll_Snapshot;
+
+/* ================================
+ * API
+ * ================================ */
+
+/* Write pool and count lists to path (through path.tmp + rename).
+   Requires index links, a pool on a caller buffer or the built-in array,
+   no growth blocks, no registered magazines, no unused reservations on
+   the pool and no quota or reservation on the saved lists (clear them
+   with gmbdll_list_set_quota(list, 0, 0) and set them again after
+   restore). Data pointers are stored as they are: persist inline
+   payloads or non-pointer values. Indexes are not stored. List owner
+   tags are not stored either: restore gives the lists new tags
+   (GMB_DLLIST_HANDLES), so handles taken before the save do not resolve
+   afterwards; take them again from the nodes.
+   Returns 0 on success, -1 on failure. */
+int gmbdll_snapshot_save(const char *path, const gmbdll_Pool *pool,
+                         const gmbdll_List *const *lists, size_t count);
+
+/* Map a snapshot file and check magic, version, build configuration and
+   header checksum; with GMB_DLLIST_SNAP_VERIFY also the node checksum.
+   Returns 0 on success, -1 on failure (missing, stale or corrupt). */
+int gmbdll_snapshot_open(gmbdll_Snapshot *snap, const char *path, int flags);
+
+/* Number of lists stored in an open snapshot */
+size_t gmbdll_snapshot_list_count(const gmbdll_Snapshot *snap);
+
+/* Initialize pool on the node array inside the mapping and count lists
+   on it (count must match the file). Constant time in the number of
+   nodes, except with GMB_DLLIST_HANDLES where the list nodes are
+   retagged (O(n)). The mapping is private: changes are not written back.
+   Returns 0 on success, -1 on failure. */
+int gmbdll_snapshot_restore(gmbdll_Snapshot *snap, gmbdll_Pool *pool,
+                            gmbdll_List *lists, size_t count);
+
+/* Unmap the snapshot. Pools and lists restored from it become invalid. */
+void gmbdll_snapshot_close(gmbdll_Snapshot *snap);
+
+#endif /* GMBSNAP_H */
@@ -0,0 +1,118 @@
+/*=================================================================
+ * gmbspsc.c
+ * Bounded single-producer/single-consumer ring buffer.
+ *
+ * The producer owns tail, the consumer owns head; each index lives on
+ * its own cache line next to the owner's cached copy of the other one.
+ * Slots are plain pointers: the release store of tail publishes the
+ * slots before it, the release store of head hands slots back.
+ *
+ * No dynamic allocation.
+ *=============================================================== */
+
+#include "gmbspsc.h"
+
+/* ---------------------------
+   Internal (static) functions
+   --------------------------- */
+
+/* Free slots seen by the producer, reloading head only when needed. */
+static size_t spsc_room(gmbdll_Spsc *q, size_t tail, size_t want) {
+    size_t room = q->mask + 1 - (tail - q->head_cache);
+    if (room < want) {
+        q->head_cache = atomic_load_explicit(&q->head, memory_order_acquire);
+        room = q->mask + 1 - (tail - q->head_cache);
+    }
+    return room;
+}
+
+/* Filled slots seen by the consumer, reloading tail only when needed. */
+static size_t spsc_ready(gmbdll_Spsc *q, size_t head, size_t want) {
+    size_t ready = q->tail_cache - head;
+    if (ready < want) {
+        q->tail_cache = atomic_load_explicit(&q->tail, memory_order_acquire);
+        ready = q->tail_cache - head;
+    }
+    return ready;
+}
+
+/* ---------------------------
+   Public API
+   (implementations for prototypes in gmbspsc.h)
+   --------------------------- */
+
+/* Initialize queue on a caller slot buffer. */
+int gmbdll_spsc_init(gmbdll_Spsc *q, void **slots, size_t nslots) {
+    if (!q || !slots) return gmbdll_ERR;
+    if (nslots < 2 || (nslots & (nslots - 1)) != 0) return gmbdll_ERR;
+    atomic_init(&q->tail, 0);
+    atomic_init(&q->head, 0);
+    q->head_cache = 0;
+    q->tail_cache = 0;
+    q->slots = slots;
+    q->mask = nslots - 1;
+    return gmbdll_OK;
+}
+
+/* Push at back. Returns 0 on success, -1 if full. */
+int gmbdll_spsc_push_back(gmbdll_Spsc *q, void *data) {
+    if (!q) return gmbdll_ERR;
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    if (spsc_room(q, tail, 1) == 0) return gmbdll_ERR;
+    q->slots[tail & q->mask] = data;
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return gmbdll_OK;
+}
+
+/* Pop from front. Returns data pointer or NULL if empty. */
+void *gmbdll_spsc_pop_front(gmbdll_Spsc *q) {
+    if (!q) return NULL;
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    if (spsc_ready(q, head, 1) == 0) return NULL;
+    void *data = q->slots[head & q->mask];
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return data;
+}
+
+/* Push n elements at back, one publish. Returns the number pushed. */
+size_t gmbdll_spsc_push_back_n(gmbdll_Spsc *q, void *const *items, size_t n) {
+    if (!q || (!items && n)) return 0;
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    size_t room = spsc_room(q, tail, n);
+    if (n > room) n = room;
+    for (size_t i = 0; i < n; ++i) q->slots[(tail + i) & q->mask] = items[i];
+    if (n) atomic_store_explicit(&q->tail, tail + n, memory_order_release);
+    return n;
+}
+
+/* Pop up to n elements from front, one release. Returns the number popped. */
+size_t gmbdll_spsc_pop_front_n(gmbdll_Spsc *q, void **out, size_t n) {
+    if (!q || (!out && n)) return 0;
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t ready = spsc_ready(q, head, n);
+    if (n > ready) n = ready;
+    for (size_t i = 0; i < n; ++i) out[i] = q->slots[(head + i) & q->mask];
+    if (n) atomic_store_explicit(&q->head, head + n, memory_order_release);
+    return n;
+}
+
+/* Return current size (snapshot) */
+size_t gmbdll_spsc_size(gmbdll_Spsc *q) {
+    if (!q) return 0;
+    size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    return tail - head;
+}
+
+/* Return 1 if queue empty, 0 otherwise */
+int gmbdll_spsc_is_empty(gmbdll_Spsc *q) {
+    return gmbdll_spsc_size(q) == 0;
+}
+
+/* Number of slots */
+size_t gmbdll_spsc_capacity(const gmbdll_Spsc *q) {
+    if (!q) return 0;
+    return q->mask + 1;
+}
+
+/* End of file */
@@ -0,0 +1,79 @@
+/*====================================
+ * File: gmbspsc.h
+ * Bounded single-producer/single-consumer FIFO on a caller
+ * slot buffer, with the gmbdll_List queue contract
+ * ===================================*/
+
+#ifndef GMBSPSC_H
+#define GMBSPSC_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "gmbdllist.h" /* return codes */
+
+/* ================================
+ * Configuration
+ * ================================ */
+
+/* Alignment used to keep producer and consumer state on separate lines */
+#ifndef GMB_DLLIST_CACHE_LINE
+#define GMB_DLLIST_CACHE_LINE 64
+#endif
+
+/* ================================
+ * Data structures
+ * ================================ */
+
+/* Ring buffer queue. Indices grow monotonically and are masked into the
+   slot buffer. Each side keeps a private copy of the other side's index
+   and only reloads it when the copy says the ring is full / empty, so
+   in steady state the shared lines move once per batch, not per element. */
+typedef struct gmbdll_Spsc {
+    /* producer */
+    _Alignas(GMB_DLLIST_CACHE_LINE) _Atomic size_t tail;  /* next slot to fill */
+    size_t head_cache;  /* last head seen by the producer */
+    /* consumer */
+    _Alignas(GMB_DLLIST_CACHE_LINE) _Atomic size_t head;  /* next slot to read */
+    size_t tail_cache;  /* last tail seen by the consumer */
+    /* read-only after init */
+    _Alignas(GMB_DLLIST_CACHE_LINE) void **slots;
+    size_t mask;  /* slot count - 1, slot count is a power of two */
+} gmbdll_Spsc;
+
+/* ================================
+ * API
+ * ================================ */
+
+/* Initialize queue on a caller buffer of nslots slots (power of two,
+   at least 2); all nslots slots are usable. The buffer must outlive the
+   queue. Must be called before either thread touches the queue. */
+int gmbdll_spsc_init(gmbdll_Spsc *q, void **slots, size_t nslots);
+
+/* Producer only: push element at the end.
+   Returns 0 on success, -1 on failure (queue full). */
+int gmbdll_spsc_push_back(gmbdll_Spsc *q, void *data);
+
+/* Consumer only: pop element from the beginning.
+   Returns data pointer or NULL if empty. */
+void *gmbdll_spsc_pop_front(gmbdll_Spsc *q);
+
+/* Producer only: push n data pointers in array order, published to the
+   consumer with a single store. Returns the number pushed (< n only if
+   the queue filled up). */
+size_t gmbdll_spsc_push_back_n(gmbdll_Spsc *q, void *const *items, size_t n);
+
+/* Consumer only: pop up to n data pointers into out[], released to the
+   producer with a single store. Returns the number popped. */
+size_t gmbdll_spsc_pop_front_n(gmbdll_Spsc *q, void **out, size_t n);
+
+/* Return current size (snapshot from any thread) */
+size_t gmbdll_spsc_size(gmbdll_Spsc *q);
+
+/* Return 1 if queue empty, 0 otherwise (snapshot from any thread) */
+int gmbdll_spsc_is_empty(gmbdll_Spsc *q);
+
+/* Number of slots */
+size_t gmbdll_spsc_capacity(const gmbdll_Spsc *q);
+
+#endif /* GMBSPSC_H */
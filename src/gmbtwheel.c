@@ -0,0 +1,159 @@
+/*=================================================================
+ * gmbtwheel.c
+ * Hierarchical timing wheel on gmbdll_Lists.
+ *
+ * A timer due in less than 2^BITS ticks sits in a level 0 slot that is
+ * emptied when its tick comes. Later timers sit on a higher level, in
+ * the slot covering their tick, and move down (cascade) when the lower
+ * level wraps around to that slot. Every timer is re-filed at most once
+ * per level, so expiry needs no scan of pending timers.
+ *=============================================================== */
+
+#include "gmbtwheel.h"
+
+#define TW_MASK ((uint64_t)GMB_DLLIST_TWHEEL_SLOTS - 1)
+#define TW_SHIFT(level) ((unsigned)(level) * GMB_DLLIST_TWHEEL_BITS)
+#define TW_SPAN ((uint64_t)1 << TW_SHIFT(GMB_DLLIST_TWHEEL_LEVELS))
+
+/* ---------------------------
+   Internal (static) functions
+   --------------------------- */
+
+/* Slot list for a timer due at expires, seen from tick now. */
+static gmbdll_List *wheel_slot(gmbdll_TimerWheel *wheel, uint64_t expires) {
+    uint64_t delta = expires - wheel->now;
+    if (delta >= TW_SPAN) {
+        /* Beyond the horizon: park in the farthest slot, re-filed on cascade */
+        expires = wheel->now + TW_SPAN - 1;
+        delta = TW_SPAN - 1;
+    }
+    int level = 0;
+    while (level < GMB_DLLIST_TWHEEL_LEVELS - 1 && delta >> TW_SHIFT(level + 1)) level++;
+    return &wheel->slots[level][(expires >> TW_SHIFT(level)) & TW_MASK];
+}
+
+/* Append timer to the slot of expires, which must be after now. The
+   timer is only updated once it is filed. */
+static int wheel_file(gmbdll_TimerWheel *wheel, gmbdll_Timer *timer, uint64_t expires) {
+    gmbdll_List *slot = wheel_slot(wheel, expires);
+    if (gmbdll_push_back(slot, timer) != gmbdll_OK) return gmbdll_ERR;
+    timer->expires = expires;
+    timer->slot = slot;
+    timer->node = gmbdll_list_tail(slot);
+    return gmbdll_OK;
+}
+
+/* Re-file the timers of the current slot of a higher level relative to
+   the current tick; they land on lower levels. Each pop frees the node
+   the following push takes, so re-filing cannot exhaust the pool. */
+static void wheel_cascade(gmbdll_TimerWheel *wheel, int level) {
+    gmbdll_List *slot = &wheel->slots[level][(wheel->now >> TW_SHIFT(level)) & TW_MASK];
+    gmbdll_Timer *timer;
+    while ((timer = gmbdll_pop_front(slot)) != NULL) {
+        (void)wheel_file(wheel, timer, timer->expires);
+    }
+}
+
+/* ---------------------------
+   Public API
+   (implementations for prototypes in gmbtwheel.h)
+   --------------------------- */
+
+/* Initialize wheel at tick now. */
+int gmbdll_twheel_init(gmbdll_TimerWheel *wheel, gmbdll_Pool *pool, uint64_t now) {
+    if (!wheel || !pool) return gmbdll_ERR;
+    for (int l = 0; l < GMB_DLLIST_TWHEEL_LEVELS; ++l) {
+        for (unsigned s = 0; s < GMB_DLLIST_TWHEEL_SLOTS; ++s) {
+            gmbdll_list_init(&wheel->slots[l][s], pool);
+        }
+    }
+    wheel->now = now;
+    wheel->count = 0;
+    return gmbdll_OK;
+}
+
+void gmbdll_timer_init(gmbdll_Timer *timer, void *data) {
+    if (!timer) return;
+    timer->expires = 0;
+    timer->slot = NULL;
+    timer->node = NULL;
+    timer->data = data;
+}
+
+int gmbdll_timer_pending(const gmbdll_Timer *timer) {
+    return timer && timer->slot != NULL;
+}
+
+/* Schedule (or move) timer. */
+int gmbdll_twheel_schedule(gmbdll_TimerWheel *wheel, gmbdll_Timer *timer, uint64_t expires) {
+    if (!wheel || !timer) return gmbdll_ERR;
+    gmbdll_twheel_cancel(wheel, timer);
+    if (expires <= wheel->now) expires = wheel->now + 1;
+    if (wheel_file(wheel, timer, expires) != gmbdll_OK) return gmbdll_ERR;
+    wheel->count++;
+    return gmbdll_OK;
+}
+
+/* Cancel a pending timer through its node handle. */
+int gmbdll_twheel_cancel(gmbdll_TimerWheel *wheel, gmbdll_Timer *timer) {
+    if (!wheel || !timer || !timer->slot) return gmbdll_ERR;
+    gmbdll_list_remove_node(timer->slot, timer->node, NULL);
+    timer->slot = NULL;
+    timer->node = NULL;
+    wheel->count--;
+    return gmbdll_OK;
+}
+
+/* Advance to tick now, firing expired timers. */
+size_t gmbdll_twheel_advance(gmbdll_TimerWheel *wheel, uint64_t now,
+                             void (*fn)(gmbdll_Timer *timer, void *ctx), void *ctx) {
+    if (!wheel) return 0;
+    size_t fired = 0;
+    while (wheel->now < now) {
+        if (wheel->count == 0) {
+            wheel->now = now; /* nothing pending: jump */
+            break;
+        }
+        wheel->now++;
+
+        /* Each level wraps when all lower bits of now are zero */
+        for (int l = 1; l < GMB_DLLIST_TWHEEL_LEVELS; ++l) {
+            if (wheel->now & (((uint64_t)1 << TW_SHIFT(l)) - 1)) break;
+            wheel_cascade(wheel, l);
+        }
+
+        gmbdll_List *slot = &wheel->slots[0][wheel->now & TW_MASK];
+        gmbdll_Timer *timer;
+        while ((timer = gmbdll_pop_front(slot)) != NULL) {
+            timer->slot = NULL;
+            timer->node = NULL;
+            wheel->count--;
+            fired++;
+            if (fn) fn(timer, ctx);
+        }
+    }
+    return fired;
+}
+
+/* Return the number of pending timers */
+size_t gmbdll_twheel_count(const gmbdll_TimerWheel *wheel) {
+    if (!wheel) return 0;
+    return wheel->count;
+}
+
+/* Cancel all pending timers. */
+void gmbdll_twheel_clear(gmbdll_TimerWheel *wheel) {
+    if (!wheel) return;
+    for (int l = 0; l < GMB_DLLIST_TWHEEL_LEVELS; ++l) {
+        for (unsigned s = 0; s < GMB_DLLIST_TWHEEL_SLOTS; ++s) {
+            gmbdll_Timer *timer;
+            while ((timer = gmbdll_pop_front(&wheel->slots[l][s])) != NULL) {
+                timer->slot = NULL;
+                timer->node = NULL;
+            }
+        }
+    }
+    wheel->count = 0;
+}
+
+/* End of file */
@@ -0,0 +1,96 @@
+/*====================================
+ * File: gmbtwheel.h
+ * Hierarchical timing wheel whose slots are gmbdll_Lists
+ * sharing one pool
+ * ===================================*/
+
+#ifndef GMBTWHEEL_H
+#define GMBTWHEEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gmbdllist.h"
+
+/* ================================
+ * Configuration
+ * ================================ */
+
+/* Slots per level = 2^GMB_DLLIST_TWHEEL_BITS. Level l holds timers due
+   within 2^(BITS * (l + 1)) ticks; with 6 bits and 4 levels the wheel
+   spans 2^24 ticks. Timers beyond that wait in the last slot of the top
+   level and are re-filed when it cascades. */
+#ifndef GMB_DLLIST_TWHEEL_BITS
+#define GMB_DLLIST_TWHEEL_BITS 6
+#endif
+
+#ifndef GMB_DLLIST_TWHEEL_LEVELS
+#define GMB_DLLIST_TWHEEL_LEVELS 4
+#endif
+
+#define GMB_DLLIST_TWHEEL_SLOTS (1u << GMB_DLLIST_TWHEEL_BITS)
+
+#if GMB_DLLIST_TWHEEL_BITS * GMB_DLLIST_TWHEEL_LEVELS > 63
+#error "GMB_DLLIST_TWHEEL_BITS * GMB_DLLIST_TWHEEL_LEVELS must not exceed 63"
+#endif
+
+/* ================================
+ * Data structures
+ * ================================ */
+
+/* Timer owned by the caller (usually embedded in the connection it
+   guards). The wheel stores a pointer to it in a slot list node and
+   keeps that node as the handle for O(1) cancel. */
+typedef struct gmbdll_Timer {
+    uint64_t expires;   /* Tick at which the timer fires */
+    gmbdll_List *slot;  /* Slot list holding the timer, NULL if not pending */
+    gmbdll_Node *node;  /* Node of the timer in slot */
+    void *data;         /* Caller data */
+} gmbdll_Timer;
+
+/* Timing wheel. now is the last tick processed by gmbdll_twheel_advance. */
+typedef struct gmbdll_TimerWheel {
+    gmbdll_List slots[GMB_DLLIST_TWHEEL_LEVELS][GMB_DLLIST_TWHEEL_SLOTS];
+    uint64_t now;
+    size_t count;  /* Pending timers */
+} gmbdll_TimerWheel;
+
+/* ================================
+ * API
+ * ================================ */
+
+/* Initialize wheel at tick now. Every slot list is initialized on pool,
+   which provides one node per pending timer. */
+int gmbdll_twheel_init(gmbdll_TimerWheel *wheel, gmbdll_Pool *pool, uint64_t now);
+
+/* Initialize a timer (not pending) carrying data */
+void gmbdll_timer_init(gmbdll_Timer *timer, void *data);
+
+/* Return 1 if timer is scheduled and has not fired yet, 0 otherwise */
+int gmbdll_timer_pending(const gmbdll_Timer *timer);
+
+/* Schedule timer at tick expires (moved if already pending). Ticks not
+   after now fire on the next tick. O(1).
+   Returns 0 on success, -1 on failure (pool exhausted, timer unchanged
+   when it was not pending, cancelled otherwise). */
+int gmbdll_twheel_schedule(gmbdll_TimerWheel *wheel, gmbdll_Timer *timer, uint64_t expires);
+
+/* Cancel a pending timer. O(1).
+   Returns 0 on success, -1 if it was not pending. */
+int gmbdll_twheel_cancel(gmbdll_TimerWheel *wheel, gmbdll_Timer *timer);
+
+/* Advance the wheel to tick now, calling fn(timer, ctx) for each timer
+   that expires, in tick order (FIFO within a tick). The wheel's now is
+   the expiring tick during the call; fn may schedule or cancel timers,
+   the fired one included. Cost is O(1) per tick plus O(1) per timer
+   fired or re-filed by a cascade. Returns the number of timers fired. */
+size_t gmbdll_twheel_advance(gmbdll_TimerWheel *wheel, uint64_t now,
+                             void (*fn)(gmbdll_Timer *timer, void *ctx), void *ctx);
+
+/* Return the number of pending timers */
+size_t gmbdll_twheel_count(const gmbdll_TimerWheel *wheel);
+
+/* Cancel all pending timers (their nodes go back to the pool) */
+void gmbdll_twheel_clear(gmbdll_TimerWheel *wheel);
+
+#endif /* GMBTWHEEL_H */
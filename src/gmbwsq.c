@@ -0,0 +1,104 @@
+/*=================================================================
+ * gmbwsq.c
+ * Lock-free work-stealing deque (Chase-Lev) on a caller buffer.
+ *
+ * C11 formulation of Le, Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+ * The owner works at bottom with plain loads/stores and one seq_cst
+ * fence per pop; thieves advance top with a CAS. The owner and a thief
+ * only race for the last task, which both settle with the same CAS
+ * on top. The buffer does not grow: push fails when it is full.
+ *
+ * No dynamic allocation.
+ *=============================================================== */
+
+#include "gmbwsq.h"
+
+/* ---------------------------
+   Public API
+   (implementations for prototypes in gmbwsq.h)
+   --------------------------- */
+
+/* Initialize deque on a caller slot buffer. */
+int gmbdll_wsdeque_init(gmbdll_WsDeque *dq, gmbdll_WsSlot *slots, size_t nslots) {
+    if (!dq || !slots) return gmbdll_ERR;
+    if (nslots < 2 || (nslots & (nslots - 1)) != 0) return gmbdll_ERR;
+    atomic_init(&dq->top, 0);
+    atomic_init(&dq->bottom, 0);
+    dq->slots = slots;
+    dq->mask = nslots - 1;
+    for (size_t i = 0; i < nslots; ++i) atomic_init(&slots[i], NULL);
+    return gmbdll_OK;
+}
+
+/* Owner push. Returns 0 on success, -1 if full. */
+int gmbdll_wsdeque_push(gmbdll_WsDeque *dq, void *data) {
+    if (!dq) return gmbdll_ERR;
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    if ((size_t)(b - t) > dq->mask) return gmbdll_ERR; /* full */
+    atomic_store_explicit(&dq->slots[(size_t)b & dq->mask], data, memory_order_relaxed);
+    /* publish the slot before the new bottom */
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+    return gmbdll_OK;
+}
+
+/* Owner pop. Returns 0 and stores data in *data_out, -1 if empty. */
+int gmbdll_wsdeque_pop(gmbdll_WsDeque *dq, void **data_out) {
+    if (!dq) return gmbdll_ERR;
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&dq->bottom, b, memory_order_relaxed);
+    /* the bottom reservation must be visible before top is read */
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+
+    if (t > b) {
+        /* empty: undo the reservation */
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+        return gmbdll_ERR;
+    }
+
+    void *data = atomic_load_explicit(&dq->slots[(size_t)b & dq->mask], memory_order_relaxed);
+    if (t == b) {
+        /* last task: race the thieves for it */
+        int won = atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                          memory_order_seq_cst,
+                                                          memory_order_relaxed);
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+        if (!won) return gmbdll_ERR;
+    }
+    if (data_out) *data_out = data;
+    return gmbdll_OK;
+}
+
+/* Steal. Returns 0 and stores data in *data_out, -1 if empty. */
+int gmbdll_wsdeque_steal(gmbdll_WsDeque *dq, void **data_out) {
+    if (!dq) return gmbdll_ERR;
+    for (;;) {
+        int64_t t = atomic_load_explicit(&dq->top, memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t b = atomic_load_explicit(&dq->bottom, memory_order_acquire);
+        if (t >= b) return gmbdll_ERR; /* empty */
+
+        /* read before the CAS: afterwards the owner may reuse the slot */
+        void *data = atomic_load_explicit(&dq->slots[(size_t)t & dq->mask],
+                                          memory_order_relaxed);
+        if (atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                    memory_order_seq_cst,
+                                                    memory_order_relaxed)) {
+            if (data_out) *data_out = data;
+            return gmbdll_OK;
+        }
+        /* another thief or the owner took it: look again */
+    }
+}
+
+/* Number of tasks (snapshot) */
+size_t gmbdll_wsdeque_size(gmbdll_WsDeque *dq) {
+    if (!dq) return 0;
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+    return b > t ? (size_t)(b - t) : 0;
+}
+
+/* End of file */
@@ -0,0 +1,67 @@
+/*====================================
+ * File: gmbwsq.h
+ * Lock-free work-stealing deque on a caller slot buffer
+ * (Chase-Lev, bounded)
+ * ===================================*/
+
+#ifndef GMBWSQ_H
+#define GMBWSQ_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "gmbdllist.h" /* return codes */
+
+/* ================================
+ * Configuration
+ * ================================ */
+
+/* Alignment used to keep top and bottom on separate cache lines */
+#ifndef GMB_DLLIST_CACHE_LINE
+#define GMB_DLLIST_CACHE_LINE 64
+#endif
+
+/* ================================
+ * Data structures
+ * ================================ */
+
+/* Slot of the circular task buffer */
+typedef _Atomic(void *) gmbdll_WsSlot;
+
+/* Work-stealing deque. One owner thread pushes and pops at the bottom
+   (LIFO, no atomic read-modify-write unless a single task is left);
+   any number of thieves steal from the top (FIFO) with a CAS.
+   Indices grow monotonically and are masked into the slot buffer. */
+typedef struct gmbdll_WsDeque {
+    _Alignas(GMB_DLLIST_CACHE_LINE) _Atomic int64_t top;     /* thieves */
+    _Alignas(GMB_DLLIST_CACHE_LINE) _Atomic int64_t bottom;  /* owner */
+    _Alignas(GMB_DLLIST_CACHE_LINE) gmbdll_WsSlot *slots;
+    size_t mask;  /* slot count - 1, slot count is a power of two */
+} gmbdll_WsDeque;
+
+/* ================================
+ * API
+ * ================================ */
+
+/* Initialize deque on a caller buffer of nslots slots (power of two,
+   at least 2). The buffer must outlive the deque. Must be called before
+   any thread touches the deque. */
+int gmbdll_wsdeque_init(gmbdll_WsDeque *dq, gmbdll_WsSlot *slots, size_t nslots);
+
+/* Owner only: push a task at the bottom.
+   Returns 0 on success, -1 if the deque is full (run the task inline). */
+int gmbdll_wsdeque_push(gmbdll_WsDeque *dq, void *data);
+
+/* Owner only: pop the most recently pushed task.
+   Returns 0 and stores it in *data_out, -1 if empty. */
+int gmbdll_wsdeque_pop(gmbdll_WsDeque *dq, void **data_out);
+
+/* Any thread: steal the oldest task. Retries while other thieves win
+   the race. Returns 0 and stores it in *data_out, -1 if empty. */
+int gmbdll_wsdeque_steal(gmbdll_WsDeque *dq, void **data_out);
+
+/* Number of tasks (snapshot, may be stale under concurrency) */
+size_t gmbdll_wsdeque_size(gmbdll_WsDeque *dq);
+
+#endif /* GMBWSQ_H */
@@ -0,0 +1,213 @@
+/*====================================================*/
+//
+//       	Unrolled linked list: each node (block) holds
+//		up to GULIST_BLOCK_ITEMS data pointers
+/*====================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "gulist.h"
+
+// --------------------------------------------------
+// Get an empty block (the spare one if available)
+// --------------------------------------------------
+static UBlock *block_alloc(gulist *list) {
+    UBlock *block = list->spare;
+
+    if (block != NULL) {
+        list->spare = NULL;
+    } else {
+        block = (UBlock *)malloc(sizeof(UBlock));
+    }
+
+    return block;
+}
+
+// --------------------------------------------------
+// Unlink an emptied block and keep it as spare (or free it)
+// Keeping one spare avoids malloc/free ping-pong when a
+// queue hovers around a block boundary
+// --------------------------------------------------
+static void block_release(gulist *list, UBlock *block) {
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    } else {
+        list->head = block->next;
+    }
+
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    } else {
+        list->tail = block->prev;
+    }
+
+    if (list->spare == NULL) {
+        list->spare = block;
+    } else {
+        free(block);
+    }
+}
+
+// --------------------------------------------------
+// Initialize list
+// --------------------------------------------------
+void ulist_init(gulist *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->spare = NULL;
+}
+
+// -------------------------------------------------
+// Push data at the tail
+// Return 0 on success, -1 on failure
+// -------------------------------------------------
+int ulist_push_back(gulist *list, void *data) {
+    UBlock *block = list->tail;
+
+    if (block == NULL || block->end == GULIST_BLOCK_ITEMS) {
+        block = block_alloc(list);
+        if (block == NULL) {
+            return -1; // allocation failed
+        }
+
+        // fill new tail blocks from the left
+        block->begin = 0;
+        block->end = 0;
+        block->next = NULL;
+        block->prev = list->tail;
+
+        if (list->tail != NULL) {
+            list->tail->next = block;
+        } else {
+            list->head = block;
+        }
+        list->tail = block;
+    }
+
+    block->items[block->end++] = data;
+    list->size++;
+    return 0;
+}
+
+// -------------------------------------------------
+// Add element at the beginning of the list
+// Return 0 on success, -1 on failure
+// -------------------------------------------------
+int ulist_push_front(gulist *list, void *data) {
+    UBlock *block = list->head;
+
+    if (block == NULL || block->begin == 0) {
+        block = block_alloc(list);
+        if (block == NULL) {
+            return -1; // allocation failed
+        }
+
+        // fill new head blocks from the right
+        block->begin = GULIST_BLOCK_ITEMS;
+        block->end = GULIST_BLOCK_ITEMS;
+        block->prev = NULL;
+        block->next = list->head;
+
+        if (list->head != NULL) {
+            list->head->prev = block;
+        } else {
+            list->tail = block;
+        }
+        list->head = block;
+    }
+
+    block->items[--block->begin] = data;
+    list->size++;
+    return 0;
+}
+
+// -------------------------------------------------
+// Remove and return the element at the beginning of the list
+// Return pointer to user data, or NULL if the list is empty
+// -------------------------------------------------
+void *ulist_pop_front(gulist *list) {
+    UBlock *block = list->head;
+
+    if (block == NULL) {
+        return NULL;
+    }
+
+    void *data = block->items[block->begin++];
+    list->size--;
+
+    if (block->begin == block->end) {
+        block_release(list, block);
+    }
+
+    return data;
+}
+
+// -------------------------------------------------
+// Remove and return the element at the end of the list
+// Return pointer to user data, or NULL if the list is empty
+// -------------------------------------------------
+void *ulist_pop_back(gulist *list) {
+    UBlock *block = list->tail;
+
+    if (block == NULL) {
+        return NULL;
+    }
+
+    void *data = block->items[--block->end];
+    list->size--;
+
+    if (block->begin == block->end) {
+        block_release(list, block);
+    }
+
+    return data;
+}
+
+// -------------------------------------------------
+// Destroy the entire list (frees all blocks, but not user data)
+// After this call, the list is empty and can be reused
+// -------------------------------------------------
+void ulist_destroy(gulist *list) {
+    UBlock *current = list->head;
+
+    while (current != NULL) {
+        UBlock *next_block = current->next;
+        free(current);
+        current = next_block;
+    }
+
+    free(list->spare);
+    ulist_init(list);
+}
+
+// -------------------------------------------------
+// Debug function: print all integers in the list
+// Assumes that data pointers are of type (int *)
+// -------------------------------------------------
+void ulist_print_int(const gulist *list) {
+    const UBlock *current = list->head;
+    int first = 1;
+
+    printf("List size: %zu\n", list->size);
+    printf("[");
+
+    while (current != NULL) {
+        for (unsigned i = current->begin; i < current->end; ++i) {
+            int *value = (int *)current->items[i];
+
+            if (!first) {
+                printf(", ");
+            }
+            first = 0;
+
+            if (value != NULL) {
+                printf("%d", *value);
+            } else {
+                printf("NULL");
+            }
+        }
+        current = current->next;
+    }
+
+    printf("]\n");
+}
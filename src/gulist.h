@@ -0,0 +1,63 @@
+#ifndef gulist_H
+#define gulist_H
+
+#include <stddef.h> // for size_t
+
+// ------------------------------------
+// Configuration
+// ------------------------------------
+
+// Data pointers stored per block. The default makes a block
+// exactly 512 bytes on LP64 targets (24-byte header + 61 pointers)
+#ifndef GULIST_BLOCK_ITEMS
+#define GULIST_BLOCK_ITEMS 61
+#endif
+
+// ------------------------------------
+// Block structure (unrolled node)
+// Occupied slots are items[begin .. end-1]
+// ------------------------------------
+typedef struct UBlock {
+    struct UBlock *next;                // pointer to the next block
+    struct UBlock *prev;                // pointer to the previous block
+    unsigned short begin;               // first occupied slot
+    unsigned short end;                 // one past the last occupied slot
+    void *items[GULIST_BLOCK_ITEMS];    // pointers to user data
+} UBlock;
+
+// ------------------------------------
+// Unrolled linked list structure
+// ------------------------------------
+typedef struct {
+    UBlock *head;         // pointer to the first block
+    UBlock *tail;         // pointer to the last block
+    size_t size;          // number of elements in the list
+    UBlock *spare;        // one emptied block kept for reuse
+} gulist;
+
+// ------------------------------------
+// Public API (same contract as gllist)
+// ------------------------------------
+
+// Initialize an empty list
+void ulist_init(gulist *list);
+
+// Add element at the end of the list
+int ulist_push_back(gulist *list, void *data);
+
+// Add element at the beginning of the list
+int ulist_push_front(gulist *list, void *data);
+
+// Remove and return the element at the beginning of the list
+void *ulist_pop_front(gulist *list);
+
+// Remove and return the element at the end of the list
+void *ulist_pop_back(gulist *list);
+
+// Destroy the entire list (frees blocks, but not user data)
+void ulist_destroy(gulist *list);
+
+// Optional: debug function for printing list of integers
+void ulist_print_int(const gulist *list);
+
+#endif // gulist_H